@@ -0,0 +1,94 @@
+#include "Utility.h"
+#include "AliasTable.h"
+
+void AliasTable::build(const double* w, int n) {
+    prob.assign(n, 0);
+    alias.resize(n);
+    total = 0;
+    for (int i = 0; i < n; i++) total += w[i];
+    if (n == 0 || total <= 0) return;
+
+    //  1   1  ĭ(small) 1 ū ĭ(large)   ä (Vose)
+    vector<double> q(n);
+    vector<int> small, large;
+    small.reserve(n); large.reserve(n);
+    for (int i = 0; i < n; i++) {
+        q[i] = w[i] * n / total;
+        alias[i] = i;
+        (q[i] < 1.0 ? small : large).push_back(i);
+    }
+    const double SCALE = 4294967296.0;
+    while (!small.empty() && !large.empty()) {
+        int s = small.back(), l = large.back();
+        small.pop_back();
+        prob[s] = (unsigned)min(SCALE - 1, q[s] * SCALE);
+        alias[s] = l;
+        q[l] -= 1.0 - q[s];
+        if (q[l] < 1.0) { large.pop_back(); small.push_back(l); }
+    }
+    //  ĭ   ̹Ƿ Ȯ 1 
+    for (int i : large) prob[i] = UINT_MAX;
+    for (int i : small) prob[i] = UINT_MAX;
+}
+
+int AliasTable::sample(unsigned long long r) const {
+    int n = (int)prob.size();
+    int i = (int)(((r >> 32) * (unsigned long long)n) >> 32);//   [0, n)
+    return (unsigned)r < prob[i] || prob[i] == UINT_MAX ? i : alias[i];
+}
+
+void ScoreSampler::buildBlock(int b) {
+    int lo = b * BLOCK, hi = min((int)w.size(), lo + BLOCK);
+    blocks[b].build(w.data() + lo, hi - lo);
+}
+
+void ScoreSampler::buildTop() {
+    vector<double> sums(blocks.size());
+    for (size_t b = 0; b < blocks.size(); b++) sums[b] = blocks[b].total;
+    top.build(sums.data(), (int)sums.size());
+}
+
+void ScoreSampler::build(const vector<Score>& score, int threads) {
+    int n = (int)score.size();
+    w.resize(n);
+    for (int i = 0; i < n; i++) w[i] = max(0, score[i]);
+    int nb = (n + BLOCK - 1) / BLOCK;
+    blocks.assign(nb, AliasTable());
+
+    if (threads <= 0) threads = max(1, (int)thread::hardware_concurrency());
+    threads = min(threads, max(1, nb));
+    vector<thread> pool;
+    for (int t = 0; t < threads; t++) {
+        pool.emplace_back([this, t, threads, nb]() {
+            for (int b = t; b < nb; b += threads) buildBlock(b);
+        });
+    }
+    for (thread& th : pool) th.join();
+    buildTop();
+}
+
+void ScoreSampler::update(int row, Score s) {
+    if (row < 0 || row >= (int)w.size()) throw out_of_range("row out of range");
+    w[row] = max(0, s);
+    buildBlock(row / BLOCK);
+    buildTop();
+}
+
+void ScoreSampler::update(const vector<pair<int, Score>>& changes) {
+    vector<int> dirty;
+    for (const auto& c : changes) {
+        if (c.first < 0 || c.first >= (int)w.size()) throw out_of_range("row out of range");
+        w[c.first] = max(0, c.second);
+        dirty.push_back(c.first / BLOCK);
+    }
+    sort(dirty.begin(), dirty.end());
+    dirty.erase(unique(dirty.begin(), dirty.end()), dirty.end());
+    for (int b : dirty) buildBlock(b);
+    if (!dirty.empty()) buildTop();
+}
+
+int ScoreSampler::sample(mt19937_64& rng) const {
+    if (top.total <= 0) return -1;
+    int b = top.sample(rng());
+    return b * BLOCK + blocks[b].sample(rng());
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include "Utility.h"
+
+// Walker/Vose Ī ǥ: ġ ϴ ǥ O(1) 
+// ĭ (ΰ, Ī) ϳ ΰ, ĭ      ڱ ڽ Ǵ Ī 
+struct AliasTable {
+    vector<unsigned> prob;//ڱ ڽ  Ȯ * 2^32 ( ؼ εҼ  )
+    vector<int> alias;
+    double total = 0;
+
+    void build(const double* w, int n);
+    int sample(unsigned long long r) const;//r: 64Ʈ  ϳ ( 32Ʈ ĭ, Ʒ 32Ʈ )
+};
+
+// score  ü  ǥ .  BLOCK  ϸ Ī ǥ ΰ,    Ī ǥ ϳ  
+//  ǥ  ̶ ķ ,  ٲ  ϰ  ǥ ٽ  (O(BLOCK + n/BLOCK))
+//   0 
+class ScoreSampler {
+public:
+    static const int BLOCK = 4096;
+
+    void build(const vector<Score>& score, int threads = 0);
+    void update(int row, Score s);
+    void update(const vector<pair<int, Score>>& changes);//ϸ   ٽ 
+    int sample(mt19937_64& rng) const;//   ȣ,   0̸ -1
+    double weight(int row) const { return w[row]; }
+    double total() const { return top.total; }
+
+private:
+    vector<double> w;
+    vector<AliasTable> blocks;
+    AliasTable top;
+
+    void buildBlock(int b);
+    void buildTop();
+};
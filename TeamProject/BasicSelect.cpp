@@ -32,6 +32,28 @@ Score quickSelect(vector<Score>& p,int top) {
 	if (p.empty()) throw out_of_range("empty vector");
 	return quickSelect(p, top, 0, (int)p.size() - 1);
 }//  Ž ٸ ϱ..  -> ǹ  ٸ ϱ.
+//   2k ũ ۸  . ĿƮκ ū  ۿ ,   quickSelect  k   ĿƮ ø
+// Ҹ  ġ ʰ ӵ ۸ ǵ O(n + k log(n/k))
+Score bufferSelect(vector<Score>& p, vector<Score>& topk, int top) {
+	int size = (int)p.size();
+	if (top <= 0 || top > size) throw out_of_range("k out of range");
+	topk.clear();
+	topk.reserve(2 * top);
+	bool hasCut = false;
+	Score cut = 0;
+	for (int i = 0; i < size; i++) {
+		if (hasCut && p[i] <= cut) continue;
+		topk.push_back(p[i]);
+		if ((int)topk.size() == 2 * top) {
+			cut = quickSelect(topk, top - 1, 0, 2 * top - 1);
+			topk.resize(top);
+			hasCut = true;
+		}
+	}
+	cut = quickSelect(topk, top - 1, 0, (int)topk.size() - 1);
+	topk.resize(top);
+	return cut;
+}
 // ó Լ
 Score binaryselect(vector<Score>& p,vector<Score>& toplist, int top) {
 	if (p.empty()) throw out_of_range("empty vector");
@@ -42,7 +64,14 @@ Score binaryselect(vector<Score>& p,vector<Score>& toplist, int top) {
 	return binaryselect(p, toplist, top, *mn_it, *mx_it);
 }
 
-Score binaryselect(vector<Score>& p, vector<Score>& result, int top, Score minv, Score maxv) {
+Score binaryselect(const VideoTable& t, vector<Score>& result, int top) {
+    if (t.size() == 0) throw out_of_range("empty vector");
+    if (top < 0 || top >= t.size()) throw out_of_range("k out of range");
+    const ColumnStats& st = t.columnStats(VideoTable::SCORE);
+    return binaryselect(t.score, result, top, (Score)st.mn, (Score)st.mx);
+}
+
+Score binaryselect(const vector<Score>& p, vector<Score>& result, int top, Score minv, Score maxv) {
     // ()   
     result.clear();
     result.reserve(top + 1);      
@@ -93,3 +122,49 @@ Score binaryselect(vector<Score>& p, vector<Score>& result, int top, Score minv,
     return lo;  // ĿƮ
 }
 
+
+// hint    ̻  cand . б   ε ÷ Ϸ ȭϱ  
+// Ƴ  need  false (ĿƮ   )
+// cand need     ؼ ĥ    ø (n ũ Ҵ/0 ä⸦  )
+static bool prefilter(const vector<Score>& p, Score hint, int need, vector<Score>& cand, Score& cut, Score& mx) {
+    long long slack = max(1LL, llabs((long long)hint) / 32);
+    cut = (Score)max((long long)INT_MIN, (long long)hint - slack);
+    int size = (int)p.size();
+    int cap = min(size, max(1024, need * 4)) + 1;// ׻ cand[m] ϹǷ  ĭ 
+    cand.resize(cap);
+    int m = 0;
+    mx = cut;
+    for (int i = 0; i < size; i++) {
+        Score x = p[i];
+        cand[m] = x;
+        m += (x >= cut);
+        mx = max(mx, x);
+        if (m == cap) { cap *= 2; cand.resize(cap); }//  Ÿ б   
+    }
+    cand.resize(m);
+    return m >= need;
+}
+
+Score sequentialSelectWarm(vector<Score>& p, Heap& topk, int top, Score hint) {
+    vector<Score> cand;
+    Score cut, mx;
+    if (!prefilter(p, hint, top, cand, cut, mx)) return sequentialSelect(p, topk, top);
+    return sequentialSelect(cand, topk, top);
+}
+
+Score quickSelectWarm(vector<Score>& p, int top, Score hint) {
+    if (p.empty()) throw out_of_range("empty vector");
+    vector<Score> cand;
+    Score cut, mx;
+    if (!prefilter(p, hint, top + 1, cand, cut, mx)) cand.assign(p.begin(), p.end());// ο Ȱ p ǵ帮 ʵ 纻 
+    return quickSelect(cand, top);
+}
+
+Score binaryselectWarm(vector<Score>& p, vector<Score>& result, int top, Score hint) {
+    if (p.empty()) throw out_of_range("empty vector");
+    if (top < 0 || top >= (int)p.size()) throw out_of_range("k out of range");
+    vector<Score> cand;
+    Score cut, mx;
+    if (!prefilter(p, hint, top + 1, cand, cut, mx)) return binaryselect(p, result, top);
+    return binaryselect(cand, result, top, cut, mx);//minmax_element  ư ִ ٷ  
+}
@@ -1,7 +1,18 @@
 #pragma once
 
 #include "Utility.h"
+#include "VideoTable.h"
 
 Score sequentialSelect(vector <Score>& p, Heap& topk, int top);
-Score quickselect(vector<Score>& p, int top);
-Score binaryselect(vector<Score>& p, int top);
\ No newline at end of file
+Score quickSelect(vector<Score>& p, int top);
+Score binaryselect(vector<Score>& p, vector<Score>& toplist, int top);
+Score binaryselect(const vector<Score>& p, vector<Score>& result, int top, Score minv, Score maxv);
+Score binaryselect(const VideoTable& t, vector<Score>& result, int top);//t.score , ּڰ/ִ  Ȯϴ columnStats(SCORE)
+Score bufferSelect(vector<Score>& p, vector<Score>& topk, int top);//topk  top(  ), ȯ ĿƮ
+
+//  ŸƮ:  Ŭ ĿƮ(hint) ޾Ƽ    ̻   ɷ   迭 
+// ɷ  ڶ  Լ ״ ưǷ hint Ʋ  
+//  Լ  p  ٲ  (quickSelectWarm ɷ 迭̳ 纻 )
+Score sequentialSelectWarm(vector<Score>& p, Heap& topk, int top, Score hint);
+Score quickSelectWarm(vector<Score>& p, int top, Score hint);
+Score binaryselectWarm(vector<Score>& p, vector<Score>& result, int top, Score hint);
@@ -143,12 +143,22 @@ static void countingSortByDigit_a(vector<Score>& p, int exp) {
     p = move(out);
 }
 
+static void radixSortUpTo(vector<Score>& p, int mx) {
+    for (int exp = 1; mx / exp > 0; exp *= 10) {
+        countingSortByDigit_a(p, exp);
+    }
+}
+
 void radixSort(vector<Score>& p) {
     int size = (int)p.size();
     if (size <= 0) return;
     int mx = p[0];
     for (int i = 1; i < size; i++) if (p[i] > mx) mx = p[i];
-    for (int exp = 1; mx / exp > 0; exp *= 10) {
-        countingSortByDigit_a(p, exp);
-    }
+    radixSortUpTo(p, mx);
+}
+
+void radixSort(const VideoTable& t, vector<Score>& out) {
+    out = t.score;
+    if (out.empty()) return;
+    radixSortUpTo(out, (int)t.columnStats(VideoTable::SCORE).mx);//ִ ٽ ã 
 }
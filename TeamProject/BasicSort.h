@@ -1,5 +1,6 @@
 #pragma once
 #include "Utility.h"
+#include "VideoTable.h"
 #include <vector>
 using namespace std;
 
@@ -14,3 +15,4 @@ void shellSort(vector<Score>& p);
 void heapSort(vector<Score>& p);
 void countingSort(vector<Score>& p, int max);
 void radixSort(vector<Score>& p);
+void radixSort(const VideoTable& t, vector<Score>& out);//t.score out  , ִ  Ȯϴ columnStats(SCORE)
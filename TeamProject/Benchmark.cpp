@@ -0,0 +1,125 @@
+#include "Utility.h"
+#include "Benchmark.h"
+#include "LoserTree.h"
+#include "BasicSelect.h"
+#include "PackedCounters.h"
+
+using namespace std;
+
+template <class F>
+static double measureMs(F f) {
+    auto st = chrono::steady_clock::now();
+    f();
+    auto ed = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(ed - st).count();
+}
+
+void benchLoserTree() {
+    const int ops = 1 << 20;
+    cout << "[LoserTree vs Heap] replace-top x " << ops << "\n";
+    cout << setw(6) << "k" << setw(14) << "heap(ms)" << setw(14) << "loser(ms)" << "\n";
+
+    for (int k = 4; k <= 4096; k *= 4) {
+        mt19937 rng(k);
+        uniform_int_distribution<int> head(0, 1000000), step(0, 1000);
+        vector<Score> heads(k), steps(ops);
+        for (Score& x : heads) x = head(rng);
+        for (Score& x : steps) x = step(rng);
+
+        // k-way merge  : ڸ   ҽ  ( ũų ) ִ´
+        long long sumHeap = 0, sumLoser = 0;
+        Heap heap(heads, Heap::MIN);
+        double tHeap = measureMs([&]() {
+            for (int i = 0; i < ops; i++) {
+                Score w = heap.top();
+                sumHeap += w;
+                heap.pop(); heap.push(w + steps[i]);
+            }
+        });
+        LoserTree lt(heads, LoserTree::MIN);
+        double tLoser = measureMs([&]() {
+            for (int i = 0; i < ops; i++) {
+                Score w = lt.top();
+                sumLoser += w;
+                lt.replaceTop(w + steps[i]);
+            }
+        });
+
+        cout << setw(6) << k << setw(14) << fixed << setprecision(2) << tHeap
+            << setw(14) << tLoser << (sumHeap == sumLoser ? "" : "  (mismatch!)") << "\n";
+    }
+}
+
+void benchBufferSelect() {
+    const int n = 1 << 22;
+    mt19937 rng(42);
+    uniform_int_distribution<int> dist(0, 100000000);
+    vector<Score> p(n);
+    for (Score& x : p) x = dist(rng);
+
+    cout << "[bufferSelect vs sequentialSelect] n = " << n << "\n";
+    cout << setw(9) << "k" << setw(14) << "heap(ms)" << setw(14) << "buffer(ms)" << "\n";
+    for (int k = 10; k <= 1000000; k *= 10) {
+        Score cutHeap = 0, cutBuf = 0;
+        double tHeap = measureMs([&]() {
+            Heap topk(Heap::MIN);
+            cutHeap = sequentialSelect(p, topk, k);
+        });
+        double tBuf = measureMs([&]() {
+            vector<Score> topk;
+            cutBuf = bufferSelect(p, topk, k);
+        });
+        cout << setw(9) << k << setw(14) << fixed << setprecision(2) << tHeap
+            << setw(14) << tBuf << (cutHeap == cutBuf ? "" : "  (mismatch!)") << "\n";
+    }
+}
+
+void benchPackedCounters() {
+    const int n = 1 << 22;
+    const int k = 100;
+    const long long wv = 1, wl = 20, wc = 50;
+    mt19937 rng(7);
+    uniform_real_distribution<double> mag(0, 18);
+    uniform_int_distribution<int> noise(0, 99);
+    VideoTable t;
+    t.viewCount.resize(n); t.likeCount.resize(n); t.commentCount.resize(n); t.score.resize(n);
+    for (int i = 0; i < n; i++) {
+        long long v = (long long)exp(mag(rng));//ȸ  ڸ   
+        t.viewCount[i] = v;
+        t.likeCount[i] = v / 40 + noise(rng);
+        t.commentCount[i] = v / 400 + noise(rng) / 10;
+        t.score[i] = (Score)min<long long>(INT_MAX, v / 100 + t.likeCount[i]);
+    }
+    for (int c = 0; c < VideoTable::COLUMNS; c++) t.touch((VideoTable::Column)c);
+
+    cout << "[PackedCounters] n = " << n << ", block = " << PackedCounters::BLOCK << ", top-" << k << "\n";
+    cout << setw(12) << "layout" << setw(12) << "MB" << setw(14) << "scores(ms)" << setw(12) << "topk(ms)" << setw(10) << "blocks" << "\n";
+
+    // :   ״ ȴ ؼ
+    vector<long long> raw(n);
+    vector<int> rawTop;
+    double tRawScore = measureMs([&]() {
+        for (int i = 0; i < n; i++) raw[i] = wv * t.viewCount[i] + wl * t.likeCount[i] + wc * t.commentCount[i];
+    });
+    double tRawTop = measureMs([&]() {
+        vector<int> id(n);
+        for (int i = 0; i < n; i++) id[i] = i;
+        partial_sort(id.begin(), id.begin() + k, id.end(), [&](int a, int b) { return raw[a] != raw[b] ? raw[a] > raw[b] : a < b; });
+        rawTop.assign(id.begin(), id.begin() + k);
+    });
+    cout << setw(12) << "raw" << setw(12) << fixed << setprecision(1) << n * 3 * sizeof(long long) / 1048576.0
+        << setw(14) << setprecision(2) << tRawScore << setw(12) << tRawScore + tRawTop << setw(10) << "-" << "\n";
+
+    for (int byScore = 0; byScore < 2; byScore++) {
+        PackedCounters pc;
+        pc.build(t, byScore != 0);
+        vector<long long> s;
+        vector<int> top;
+        int scanned = 0;
+        double tScore = measureMs([&]() { pc.weightedScores(wv, wl, wc, s); });
+        double tTop = measureMs([&]() { top = pc.topK(k, wv, wl, wc, &scanned); });
+        cout << setw(12) << (byScore ? "by score" : "as is") << setw(12) << setprecision(1) << pc.memoryBytes() / 1048576.0
+            << setw(14) << setprecision(2) << tScore << setw(12) << tTop
+            << setw(10) << scanned << (s == raw && top == rawTop ? "" : "  (mismatch!)") << "\n";
+    }
+}
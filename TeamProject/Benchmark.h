@@ -0,0 +1,7 @@
+#pragma once
+#include "Utility.h"
+
+// ڷᱸ/  񱳿 Լ , main ʿ ͸  ȣ
+void benchLoserTree();//LoserTree vs Heap,  ü  (k = 4 ~ 4096)
+void benchBufferSelect();//bufferSelect vs sequentialSelect(Heap), k = 10 ~ 1M
+void benchPackedCounters();//ī   vs  ( / ): ޸,  ü , top-k
@@ -0,0 +1,157 @@
+#include "Utility.h"
+#include "BinaryLogger.h"
+
+static const char MAGIC[4] = { 'Y', 'T', 'L', 'G' };
+static const unsigned FORMAT = 1;
+
+atomic<unsigned> BinaryLogger::serials{ 0 };
+
+bool BinaryLogger::open(const string& path) {
+    close();
+    file.open(path, ios::binary | ios::trunc);
+    if (!file) return false;
+    unsigned recSize = sizeof(LogRecord);
+    file.write(MAGIC, 4);
+    file.write((const char*)&FORMAT, sizeof(FORMAT));
+    file.write((const char*)&recSize, sizeof(recSize));
+    {
+        //  close() ģ log()   ڿ  ڵ  ð ̶  Ͽ  ʰ 
+        lock_guard<mutex> g(ringLock);
+        for (auto& r : rings) r->head.store(r->tail.load(memory_order_acquire), memory_order_relaxed);
+    }
+    start = chrono::steady_clock::now();
+    drops = 0;
+    writes = 0;
+    running = true;
+    drainer = thread(&BinaryLogger::drainLoop, this);
+    return true;
+}
+
+void BinaryLogger::close() {
+    if (!running) return;
+    running = false;
+    drainer.join();//drainLoop       
+    file.close();
+}
+
+BinaryLogger::ThreadCache::~ThreadCache() {
+    for (const CacheEntry& e : entries) {
+        shared_ptr<Ring> r = e.keep.lock();
+        if (r) r->inUse.store(false, memory_order_release);
+    }
+}
+
+BinaryLogger::Ring* BinaryLogger::myRing() {
+    static thread_local ThreadCache cache;
+    for (const CacheEntry& e : cache.entries) if (e.serial == serial) return e.ring;
+    shared_ptr<Ring> r;
+    {
+        lock_guard<mutex> g(ringLock);
+        for (auto& x : rings) {
+            if (!x->inUse.load(memory_order_acquire)) { r = x; break; }//  .  ڵ  尡 ״ 
+        }
+        if (!r && rings.size() < MAX_RINGS) {
+            r.reset(new Ring());
+            r->id = (unsigned short)rings.size();
+            rings.push_back(r);
+        }
+        if (!r) return nullptr;//д ĳ . ٸ 尡     ȣ⿡ 
+        r->inUse.store(true, memory_order_relaxed);
+    }
+    // ̹  ΰ ׸ ⼭ ġ
+    auto& es = cache.entries;
+    es.erase(remove_if(es.begin(), es.end(), [](const CacheEntry& e) { return e.keep.expired(); }), es.end());
+    CacheEntry e;
+    e.serial = serial;
+    e.ring = r.get();
+    e.keep = r;
+    es.push_back(e);
+    return e.ring;
+}
+
+void BinaryLogger::log(unsigned short event, int a, long long b, long long c) {
+    if (!running.load(memory_order_acquire)) return;//open() start   ̵
+    Ring* r = myRing();
+    if (!r) { drops.fetch_add(1, memory_order_relaxed); return; }
+    unsigned t = r->tail.load(memory_order_relaxed);
+    if (t - r->head.load(memory_order_acquire) == RING) { drops.fetch_add(1, memory_order_relaxed); return; }
+    LogRecord& e = r->rec[t & (RING - 1)];
+    e.time = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+    e.event = event;
+    e.thread = r->id;
+    e.a = a;
+    e.b = b;
+    e.c = c;
+    r->tail.store(t + 1, memory_order_release);
+}
+
+//   ݱ    Ͽ . ϳ  true
+bool BinaryLogger::drainOnce(vector<LogRecord>& tmp) {
+    vector<Ring*> snap;
+    {
+        lock_guard<mutex> g(ringLock);
+        for (auto& r : rings) snap.push_back(r.get());
+    }
+    bool any = false;
+    for (Ring* r : snap) {
+        unsigned h = r->head.load(memory_order_relaxed), t = r->tail.load(memory_order_acquire);
+        if (h == t) continue;
+        tmp.clear();
+        for (unsigned i = h; i != t; i++) tmp.push_back(r->rec[i & (RING - 1)]);
+        r->head.store(t, memory_order_release);
+        file.write((const char*)tmp.data(), tmp.size() * sizeof(LogRecord));
+        writes.fetch_add((long long)tmp.size(), memory_order_relaxed);
+        any = true;
+    }
+    return any;
+}
+
+void BinaryLogger::drainLoop() {
+    vector<LogRecord> tmp;
+    tmp.reserve(RING);
+    while (running.load()) {
+        if (!drainOnce(tmp)) this_thread::sleep_for(chrono::milliseconds(1));
+    }
+    while (drainOnce(tmp)) {}
+    file.flush();
+}
+
+bool readLog(const string& path, vector<LogRecord>& out) {
+    out.clear();
+    ifstream f(path, ios::binary);
+    if (!f) return false;
+    char magic[4];
+    unsigned format = 0, recSize = 0;
+    f.read(magic, 4);
+    f.read((char*)&format, sizeof(format));
+    f.read((char*)&recSize, sizeof(recSize));
+    bool ok = f && memcmp(magic, MAGIC, 4) == 0 && format == FORMAT && recSize == sizeof(LogRecord);
+    if (ok) {
+        LogRecord buf[1024];
+        while (f.read((char*)buf, sizeof(buf)) || f.gcount() > 0) {
+            size_t got = (size_t)f.gcount() / sizeof(LogRecord);// ߸ ڵ 
+            out.insert(out.end(), buf, buf + got);
+            if (!f) break;
+        }
+    }
+    // 庰  Ƿ ð  ٽ 
+    stable_sort(out.begin(), out.end(), [](const LogRecord& x, const LogRecord& y) { return x.time < y.time; });
+    return ok;
+}
+
+static const char* eventName(unsigned short e) {
+    switch (e) {
+    case EV_CYCLE_BEGIN: return "cycle_begin";
+    case EV_CYCLE_END: return "cycle_end";
+    case EV_QUERY: return "query";
+    case EV_SELECT: return "select";
+    default: return e >= EV_USER ? "user" : "unknown";
+    }
+}
+
+void dumpLog(const vector<LogRecord>& recs, FILE* out) {
+    for (const LogRecord& r : recs) {
+        fprintf(out, "%14.6f ms  t%-3u %-12s(%u) a=%d b=%lld c=%lld\n",
+            r.time / 1e6, (unsigned)r.thread, eventName(r.event), (unsigned)r.event, r.a, r.b, r.c);
+    }
+}
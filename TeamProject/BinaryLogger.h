@@ -0,0 +1,76 @@
+#pragma once
+#include "Utility.h"
+
+// / 带  ʴ ̺Ʈ α
+// 帶  ũ  ( 1, Һ 1̶  ) 32Ʈ ڵ带 ְ,
+// ׶ 尡 Ƽ Ͽ ״ .  д ·δ readLog/dumpLog ߿ ǯ
+enum LogEvent : unsigned short {
+    EV_CYCLE_BEGIN = 1,//a: ֱ ȣ
+    EV_CYCLE_END,//a: ֱ ȣ, b: ó  
+    EV_QUERY,//a:  , b: k, c: ɸ ð(ns)
+    EV_SELECT,//a:  ȣ, b: n, c: ɸ ð(ns)
+    EV_USER = 1000// ڷδ  ؼ 
+};
+
+struct LogRecord {
+    long long time;//open()  ns
+    unsigned short event;
+    unsigned short thread;//ΰ ȿ ű  ȣ (    尡 ̾Ƿ  ȣ ٽ   )
+    int a;
+    long long b, c;
+};
+
+class BinaryLogger {
+public:
+    static const unsigned RING = 1 << 14;// ڵ  (2 ŵ)
+    static const size_t MAX_RINGS = 1 << 16;// ȣ unsigned short  ̻ ÿ    
+
+    BinaryLogger() : serial(++serials) {}
+    ~BinaryLogger() { close(); }
+    BinaryLogger(const BinaryLogger&) = delete;
+    BinaryLogger& operator=(const BinaryLogger&) = delete;
+
+    bool open(const string& path);//    , ϸ false
+    void close();// ڵ带   
+    void log(unsigned short event, int a = 0, long long b = 0, long long c = 0);//۰  ְų       dropped() ø
+    long long dropped() const { return drops.load(); }
+    long long written() const { return writes.load(); }
+
+private:
+    struct Ring {
+        atomic<unsigned> head{ 0 };//Һ( ) 
+        char pad[60];//head tail ٸ ĳ ٿ
+        atomic<unsigned> tail{ 0 };//(α  ) 
+        unsigned short id = 0;
+        atomic<bool> inUse{ true };// 尡  false, ó α׸  ٸ 尡 ̾
+        LogRecord rec[RING];
+    };
+    // 帶 (ΰ ȣ, )   ־ ΰŸ  ᵵ ΰŸ ó    
+    // 尡     ִ ΰ  ٰ ǥ (weak_ptr̶ ΰŰ   )
+    struct CacheEntry {
+        unsigned serial;
+        Ring* ring;
+        weak_ptr<Ring> keep;
+    };
+    struct ThreadCache {
+        vector<CacheEntry> entries;
+        ~ThreadCache();
+    };
+
+    static atomic<unsigned> serials;
+    const unsigned serial;//庰 ĳð ٸ(Ǵ  ּҿ  ) ΰŸ ϴ ȣ
+    ofstream file;
+    chrono::steady_clock::time_point start;
+    mutex ringLock;
+    vector<shared_ptr<Ring>> rings;
+    thread drainer;
+    atomic<bool> running{ false };
+    atomic<long long> drops{ 0 }, writes{ 0 };
+
+    Ring* myRing();
+    void drainLoop();
+    bool drainOnce(vector<LogRecord>& tmp);
+};
+
+bool readLog(const string& path, vector<LogRecord>& out);//ð  ؼ ,  ٸ false
+void dumpLog(const vector<LogRecord>& recs, FILE* out);// ٿ ڵ ϳ
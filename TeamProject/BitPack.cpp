@@ -0,0 +1,48 @@
+#include "Utility.h"
+#include "BitPack.h"
+
+void PackedColumn::pack(const long long* v, int count) {
+    n = count;
+    words.clear();
+    if (count == 0) { base = 0; bits = 0; return; }
+    long long mn = v[0], mx = v[0];
+    for (int i = 1; i < count; i++) { mn = min(mn, v[i]); mx = max(mx, v[i]); }
+    base = mn;
+    bits = bitWidth((unsigned long long)mx - (unsigned long long)mn);
+    if (bits == 0) return;
+    words.assign(((unsigned long long)count * bits + 63) / 64 + 1, 0);
+    unsigned long long off = 0;
+    for (int i = 0; i < count; i++, off += bits) {
+        unsigned long long x = (unsigned long long)v[i] - (unsigned long long)mn;
+        int w = (int)(off >> 6), sh = (int)(off & 63);
+        words[w] |= x << sh;
+        if (sh + bits > 64) words[w + 1] |= x >> (64 - sh);
+    }
+}
+
+//  ϳ Ϳ  Ʈ о  Ǫ  . get() ݺϴ ͺ /ε 
+template <typename Sink>
+static void unpackRun(const PackedColumn& c, int lo, int hi, Sink sink) {
+    if (c.bits == 0) { for (int i = lo; i < hi; i++) sink(i - lo, c.base); return; }
+    const int bits = c.bits;
+    const unsigned long long mask = bits >= 64 ? ~0ULL : (1ULL << bits) - 1;
+    unsigned long long off = (unsigned long long)lo * bits;
+    const unsigned long long* w = c.words.data() + (off >> 6);
+    int sh = (int)(off & 63);
+    for (int i = lo; i < hi; i++) {
+        unsigned long long x = *w >> sh;
+        if (sh + bits > 64) x |= w[1] << (64 - sh);
+        sink(i - lo, c.base + (long long)(x & mask));
+        sh += bits;
+        w += sh >> 6;
+        sh &= 63;
+    }
+}
+
+void PackedColumn::unpack(int lo, int hi, long long* out) const {
+    unpackRun(*this, lo, hi, [out](int j, long long x) { out[j] = x; });
+}
+
+void PackedColumn::addTo(int lo, int hi, long long* acc) const {
+    unpackRun(*this, lo, hi, [acc](int j, long long x) { acc[j] += x; });
+}
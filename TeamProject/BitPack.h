@@ -0,0 +1,27 @@
+#pragma once
+#include "Utility.h"
+
+//   FOR(frame of reference) + Ʈ ŷ : ּڰ    ʿ Ʈ 
+//  ϳ O(1)   ְ,   Ǯ鼭 ٷ ϰų Ѱ  
+struct PackedColumn {
+    long long base = 0;
+    int bits = 0;//0̸   base
+    int n = 0;
+    vector<unsigned long long> words;//  带  ּ  忡 ģ   ˻  
+
+    void pack(const long long* v, int count);
+    long long get(int i) const {
+        if (bits == 0) return base;
+        unsigned long long off = (unsigned long long)i * bits;
+        int w = (int)(off >> 6), sh = (int)(off & 63);
+        unsigned long long x = words[w] >> sh;
+        if (sh + bits > 64) x |= words[w + 1] << (64 - sh);
+        return base + (long long)(x & mask());
+    }
+    void unpack(int lo, int hi, long long* out) const;//out[0..hi-lo) = [lo..hi)
+    void addTo(int lo, int hi, long long* acc) const;//acc[i-lo] += [i]
+    size_t bytes() const { return words.size() * sizeof(unsigned long long) + sizeof(*this); }
+
+private:
+    unsigned long long mask() const { return bits >= 64 ? ~0ULL : (1ULL << bits) - 1; }
+};
@@ -0,0 +1,49 @@
+#include "Utility.h"
+#include "ColumnStats.h"
+
+double ColumnStats::mean() const { return count ? (double)sum / count : 0.0; }
+
+int histBin(long long x) {
+    if (x == 0) return 32;
+    if (x > 0) return 32 + min(32, bitWidth((unsigned long long)x));
+    return 32 - min(32, bitWidth(0ULL - (unsigned long long)x));
+}
+
+// ĳÿ  ũ(BLOCK) ߶   . ù ° б  min/max/sum/ĵ  ȭǰ,
+//  ° ׷ ĭ   .  ĳÿ  ־  ° ޸𸮸 ٽ  
+template <class T>
+static ColumnStats computeStatsT(const T* p, int n) {
+    ColumnStats st;
+    st.count = n;
+    st.sum = 0;
+    st.mn = st.mx = 0;
+    fill(st.hist, st.hist + ColumnStats::BINS, 0);
+    st.sortedness = 1.0;
+    if (n <= 0) return st;
+
+    const int BLOCK = 4096;
+    T mn = p[0], mx = p[0];
+    long long sum = 0;
+    int desc = 0;
+    for (int lo = 0; lo < n; lo += BLOCK) {
+        int hi = min(n, lo + BLOCK);
+        int pairEnd = min(hi, n - 1);//p[i+1] Ƿ  ҿ  (    ù ҿ )
+        for (int i = lo; i < hi; i++) {
+            T x = p[i];
+            mn = x < mn ? x : mn;
+            mx = x > mx ? x : mx;
+            sum += x;
+        }
+        for (int i = lo; i < pairEnd; i++) desc += (p[i] >= p[i + 1]);
+        for (int i = lo; i < hi; i++) st.hist[histBin(p[i])]++;
+    }
+    st.mn = mn;
+    st.mx = mx;
+    st.sum = sum;
+    if (n > 1) st.sortedness = (double)desc / (n - 1);
+    return st;
+}
+
+ColumnStats computeStats(const Score* p, int n) { return computeStatsT(p, n); }
+ColumnStats computeStats(const long long* p, int n) { return computeStatsT(p, n); }
+ColumnStats computeStats(const vector<Score>& p) { return computeStatsT(p.data(), (int)p.size()); }
@@ -0,0 +1,20 @@
+#pragma once
+#include "Utility.h"
+
+//  (column)   Ⱦ  . binaryselect/radixSort/countingSort   ּڰ/ִ ٽ ã ʵ 
+struct ColumnStats {
+    static const int BINS = 65;//α  ׷:  32ĭ + 0 +  32ĭ
+    long long mn;
+    long long mx;
+    long long sum;
+    int count;
+    int hist[BINS];//hist[histBin(x)] = , ȸ/ó      2 ŵ 
+    double sortedness;//     ũų  , 1̸ ̹   ( / 1 1)
+
+    double mean() const;
+};
+
+int histBin(long long x);//x  ׷ ĭ, 0 (32),  x 32 + Ʈ 
+ColumnStats computeStats(const Score* p, int n);
+ColumnStats computeStats(const long long* p, int n);
+ColumnStats computeStats(const vector<Score>& p);
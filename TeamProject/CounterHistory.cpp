@@ -0,0 +1,120 @@
+#include "Utility.h"
+#include "CounterHistory.h"
+
+CounterHistory::CounterHistory(int slots) : slots(slots) {
+    if (slots < 2) throw invalid_argument("history needs at least 2 slots");
+    times.assign(slots, 0);
+}
+
+void CounterHistory::grow(int m) {
+    if (m <= n) return;
+    // [ĭ][] ġ   ø ĭ ڸ ٽ ƾ  ( ֱ  ̶  )
+    vector<int> d((size_t)slots * m, 0);
+    for (int s = 0; s < slots; s++)
+        copy(delta.begin() + (size_t)s * n, delta.begin() + (size_t)(s + 1) * n, d.begin() + (size_t)s * m);
+    delta.swap(d);
+    last.resize(m, 0);
+    since.resize(m, LLONG_MAX);
+    n = m;
+}
+
+void CounterHistory::push(long long t, const vector<long long>& value) {
+    if (total > 0 && t < times[slotOf(total - 1)]) throw invalid_argument("history time went backwards");
+    grow((int)value.size());
+    int s = slotOf(total);
+    times[s] = t;
+    int* d = &delta[(size_t)s * n];
+    for (int i = 0; i < n; i++) {
+        long long v = i < (int)value.size() ? value[i] : -1;
+        if (v < 0) { d[i] = 0; continue; }
+        if (since[i] == LLONG_MAX) { since[i] = t; last[i] = v; d[i] = 0; continue; }
+        long long diff = v - last[i];
+        d[i] = (int)max<long long>(INT_MIN, min<long long>(INT_MAX, diff));// ֱ⿡ 21 Ѱ ϴ  ٰ 
+        last[i] = v;
+    }
+    total++;
+}
+
+void CounterHistory::push(long long t, const vector<Video>& videos, long long Video::* field) {
+    vector<long long> v(videos.size());
+    for (size_t i = 0; i < videos.size(); i++) v[i] = videos[i].*field;
+    push(t, v);
+}
+
+void CounterHistory::series(int row, vector<pair<long long, long long>>& out) const {
+    out.clear();
+    if (row < 0 || row >= n) throw out_of_range("row out of range");
+    if (since[row] == LLONG_MAX) return;
+    // ֱ  ̸ Ųٷ 鼭 Ž ö
+    long long v = last[row];
+    for (long long c = total - 1; c >= total - cycles() && times[slotOf(c)] >= since[row]; c--) {
+        out.push_back(make_pair(times[slotOf(c)], v));
+        v -= delta[(size_t)slotOf(c) * n + row];
+    }
+    reverse(out.begin(), out.end());
+}
+
+void CounterHistory::windowSum(long long from, long long to, vector<long long>& sum) const {
+    sum.assign(n, 0);
+    for (long long c = from + 1; c <= to; c++) {
+        const int* d = &delta[(size_t)slotOf(c) * n];
+        long long* s = sum.data();
+        for (int i = 0; i < n; i++) s[i] += d[i];
+    }
+}
+
+void CounterHistory::velocity(vector<double>& out, int span) const {
+    out.assign(n, 0.0);
+    long long now = total - 1;
+    span = (int)min<long long>(span, cycles() - 1);
+    if (span <= 0) return;
+    vector<long long> sum;
+    windowSum(now - span, now, sum);
+    long long tEnd = times[slotOf(now)], tStart = times[slotOf(now - span)];
+    for (int i = 0; i < n; i++) {
+        double hours = (tEnd - max(tStart, since[i])) / 3600.0;
+        out[i] = hours > 0 ? sum[i] / hours : 0.0;
+    }
+}
+
+void CounterHistory::acceleration(vector<double>& out, int span) const {
+    out.assign(n, 0.0);
+    long long now = total - 1;
+    span = (int)min<long long>(span, (cycles() - 1) / 2);
+    if (span <= 0) return;
+    vector<long long> recent, prev;
+    windowSum(now - span, now, recent);
+    windowSum(now - 2 * span, now - span, prev);
+    long long t0 = times[slotOf(now - 2 * span)], t1 = times[slotOf(now - span)], t2 = times[slotOf(now)];
+    double h1 = (t1 - t0) / 3600.0, h2 = (t2 - t1) / 3600.0;
+    if (h1 <= 0 || h2 <= 0) return;
+    double mid = (h1 + h2) / 2;
+    for (int i = 0; i < n; i++) {
+        double a = (recent[i] / h2 - prev[i] / h1) / mid;
+        out[i] = since[i] <= t0 ? a : 0.0;//   ä   ӵ   
+    }
+}
+
+double CounterHistory::spanHours(int span) const {
+    span = (int)min<long long>(span, cycles() - 1);
+    if (span <= 0) return 0.0;
+    return (times[slotOf(total - 1)] - times[slotOf(total - 1 - span)]) / 3600.0;
+}
+
+size_t CounterHistory::memoryBytes() const {
+    return delta.size() * sizeof(int) + (last.size() + since.size() + times.size()) * sizeof(long long);
+}
+
+void trendScores(const CounterHistory& views, vector<Score>& out, int span) {
+    vector<double> vel, acc;
+    views.velocity(vel, span);
+    views.acceleration(acc, span);
+    int n = views.videos();
+    out.resize(n);
+    // ӵ ȴٰ     ӵ , پ  0 
+    double ahead = views.spanHours(span) / 2;
+    for (int i = 0; i < n; i++) {
+        double v = max(0.0, vel[i] + acc[i] * ahead);
+        out[i] = CovScore((Score)min(v, (double)INT_MAX));
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include "Utility.h"
+
+//  ī(ȸ, ƿ ) ֱ  ̷.  ֱ⸶      
+// 󸶴 slotsĭ¥  ۿ   (int) ϰ, ϳ ӵ 迭 ĭ   
+// [ĭ][] ġ "  ӵ/ӵ"  ĭ  ޸𸮸 ȴ  
+class CounterHistory {
+public:
+    explicit CounterHistory(int slots = 16);
+
+    void push(long long t, const vector<long long>& value);//t:  ð(), value[i] < 0 ̸ ̹ ֱ⿡     ȭ 0
+    void push(long long t, const vector<Video>& videos, long long Video::* field);//: push(t, videos, &Video::viewCount)
+
+    int videos() const { return n; }
+    int cycles() const { return (int)min<long long>(total, slots); }// ִ ֱ 
+    long long latest(int row) const { return last[row]; }
+    void series(int row, vector<pair<long long, long long>>& out) const;//(ð, )  ͺ, ó   ĸ
+
+    // ֱ spanֱ  ð . ߿ ó Ÿ  Ÿ  ð 
+    void velocity(vector<double>& out, int span) const;
+    // (ֱ spanֱ ӵ -   spanֱ ӵ) /   ߰  ð(ð^2).   ̷  0
+    void acceleration(vector<double>& out, int span) const;
+    double spanHours(int span) const;//ֱ spanֱⰡ  ð
+    size_t memoryBytes() const;
+
+private:
+    int slots;
+    int n = 0;
+    long long total = 0;//ݱ push ֱ 
+    vector<long long> times;//ĭ  ð
+    vector<int> delta;//[ĭ * n + ]
+    vector<long long> last;//  ֱ  (̸   )
+    vector<long long> since;// ó   ð,   LLONG_MAX
+
+    int slotOf(long long cycle) const { return (int)(cycle % slots); }
+    void grow(int m);
+    void windowSum(long long from, long long to, vector<long long>& sum) const;//ֱ (from, to]  
+};
+
+// ȸ ̷ " spanֱ   ð ȸ"  CovScore ȭ
+void trendScores(const CounterHistory& views, vector<Score>& out, int span = 4);
@@ -0,0 +1,92 @@
+#include "Utility.h"
+#include "DiverseSelect.h"
+
+vector<int> groupIds(const vector<Video>& videos, const string Video::* field) {
+    unordered_map<string, int> idOf;
+    vector<int> g(videos.size());
+    for (size_t i = 0; i < videos.size(); i++) {
+        auto it = idOf.emplace(videos[i].*field, (int)idOf.size()).first;
+        g[i] = it->second;
+    }
+    return g;
+}
+
+static bool byScore(const pair<Score, int>& a, const pair<Score, int>& b) {// ,    
+    return a.first != b.first ? a.first > b.first : a.second < b.second;
+}
+
+// buf      Ű տ .  ġ accepted ǥ
+// k    ġ ȯ,  ä -1
+static int greedy(vector<pair<Score, int>>& buf, int k, const vector<DiversityCap>& caps,
+    vector<vector<int>>& cnt, vector<char>& accepted) {
+    sort(buf.begin(), buf.end(), byScore);
+    accepted.assign(buf.size(), 0);
+    int taken = 0, last = -1;
+    for (int i = 0; i < (int)buf.size() && taken < k; i++) {
+        int row = buf[i].second;
+        bool ok = true;
+        for (size_t a = 0; a < caps.size() && ok; a++) ok = cnt[a][caps[a].group[row]] < caps[a].cap;
+        if (!ok) continue;
+        for (size_t a = 0; a < caps.size(); a++) cnt[a][caps[a].group[row]]++;
+        accepted[i] = 1;
+        taken++;
+        last = i;
+    }
+    for (int i = 0; i < (int)buf.size(); i++) {// ȣ  īƮ ǵ ( ͸  )
+        if (!accepted[i]) continue;
+        for (size_t a = 0; a < caps.size(); a++) cnt[a][caps[a].group[buf[i].second]]--;
+    }
+    return taken == k ? last : -1;
+}
+
+vector<int> diverseTopK(const vector<Score>& score, int k, const vector<DiversityCap>& caps,
+    int poolFactor, bool* complete) {
+    int n = (int)score.size();
+    if (k <= 0) throw out_of_range("k out of range");
+    vector<vector<int>> cnt(caps.size());
+    for (size_t a = 0; a < caps.size(); a++) {
+        if ((int)caps[a].group.size() != n) throw invalid_argument("cap group size mismatch");
+        int groups = 0;
+        for (int g : caps[a].group) groups = max(groups, g + 1);
+        cnt[a].assign(groups, 0);
+    }
+
+    //  ϳ̸( Ʈ̵)  Ż  ߿  ƿ Ƿ  ͸ 
+    //   ٸ Ӽ    ǻƳ  ־   pool °  
+    bool single = caps.size() <= 1;
+    int pool = single ? k : k * max(1, poolFactor);
+    vector<pair<Score, int>> buf;
+    buf.reserve(2 * (size_t)pool);
+    vector<char> accepted;
+    bool hasCut = false, dropped = false;
+    Score cut = 0;
+
+    auto shrink = [&]() {
+        if (single) {
+            int last = greedy(buf, k, caps, cnt, accepted);
+            int m = 0;
+            for (int i = 0; i < (int)buf.size(); i++) if (accepted[i]) buf[m++] = buf[i];
+            buf.resize(m);
+            if (last >= 0) { cut = buf.back().first; hasCut = true; }
+        }
+        else {
+            nth_element(buf.begin(), buf.begin() + (pool - 1), buf.end(), byScore);
+            cut = buf[pool - 1].first;//    иǷ Ŀ     
+            buf.resize(pool);
+            hasCut = true;
+            dropped = true;
+        }
+    };
+
+    for (int i = 0; i < n; i++) {
+        if (hasCut && score[i] <= cut) { dropped = dropped || !single; continue; }
+        buf.push_back(make_pair(score[i], i));
+        if ((int)buf.size() >= 2 * pool) shrink();
+    }
+
+    int last = greedy(buf, k, caps, cnt, accepted);
+    if (complete) *complete = single || last >= 0 || !dropped;
+    vector<int> rows;
+    for (int i = 0; i < (int)buf.size(); i++) if (accepted[i]) rows.push_back(buf[i].second);
+    return rows;
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include "Utility.h"
+
+// Ӽ ϳ  : group[i] i  ׷ ȣ(ä, īװ ),  ׷쿡 ִ cap
+struct DiversityCap {
+    vector<int> group;
+    int cap;
+};
+
+//   鼭  Ѵ  ǳʶٴ (Ȩ ȭ Ģ)     н 
+//  ϳ ׻ Ȯ.     k*poolFactor ĺ ȿ k  á  Ȯϰ,
+//  ä complete false (׷  պκ  պκа )
+vector<int> diverseTopK(const vector<Score>& score, int k, const vector<DiversityCap>& caps,
+    int poolFactor = 4, bool* complete = nullptr);
+
+vector<int> groupIds(const vector<Video>& videos, const string Video::* field);//ڿ ʵ(channelId ) 0 ϴ ׷ ȣ
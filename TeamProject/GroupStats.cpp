@@ -0,0 +1,157 @@
+#include "Utility.h"
+#include "GroupStats.h"
+#include "DiverseSelect.h"
+
+void GroupStats::add(double x) {
+    count++;
+    double d = x - mean;
+    mean += d / count;
+    m2 += d * (x - mean);
+}
+
+void GroupStats::merge(const GroupStats& o) {
+    if (o.count == 0) return;
+    if (count == 0) { *this = o; return; }
+    long long n = count + o.count;
+    double d = o.mean - mean;
+    mean += d * o.count / n;
+    m2 += o.m2 + d * d * ((double)count * o.count / n);
+    count = n;
+}
+
+static int groupCount(const vector<int>& group) {
+    int groups = 0;
+    for (int g : group) {
+        if (g < 0) throw out_of_range("negative group id");
+        groups = max(groups, g + 1);
+    }
+    return groups;
+}
+
+static int threadCount(int threads, int n) {
+    if (threads <= 0) threads = max(1, (int)thread::hardware_concurrency());
+    return min(threads, max(1, n / 65536));
+}
+
+// [0, n) threads   f(lo, hi, t)  
+template <typename F>
+static void parallelRanges(int n, int threads, F f) {
+    if (threads == 1) { f(0, n, 0); return; }
+    vector<thread> pool;
+    for (int t = 0; t < threads; t++) {
+        int lo = (int)((long long)n * t / threads), hi = (int)((long long)n * (t + 1) / threads);
+        pool.emplace_back(f, lo, hi, t);
+    }
+    for (thread& th : pool) th.join();
+}
+
+vector<GroupStats> groupStats(const vector<Score>& value, const vector<int>& group, int groups, int threads) {
+    int n = (int)value.size();
+    if ((int)group.size() != n) throw invalid_argument("group size mismatch");
+    for (int g : group) if (g < 0 || g >= groups) throw out_of_range("group id out of range");// ȿ    Ƿ ̸ Ȯ
+    threads = threadCount(threads, n);
+    vector<vector<GroupStats>> part(threads, vector<GroupStats>(groups));
+    parallelRanges(n, threads, [&](int lo, int hi, int t) {
+        vector<GroupStats>& s = part[t];
+        for (int i = lo; i < hi; i++) s[group[i]].add(value[i]);
+    });
+    for (int t = 1; t < threads; t++)
+        for (int g = 0; g < groups; g++) part[0][g].merge(part[t][g]);
+    return part[0];
+}
+
+void normalizeByGroup(vector<Score>& value, const vector<int>& group, NormMode mode, int threads) {
+    int n = (int)value.size();
+    if ((int)group.size() != n) throw invalid_argument("group size mismatch");
+    int groups = groupCount(group);
+    threads = threadCount(threads, n);
+
+    if (mode == Z_SCORE) {
+        vector<GroupStats> st = groupStats(value, group, groups, threads);
+        // ׷츶 x * a + b    ̸  (  / ϳ)
+        vector<double> a(groups), b(groups);
+        for (int g = 0; g < groups; g++) {
+            double sd = st[g].stddev();
+            a[g] = sd > 0 ? Z_SCALE / sd : 0.0;
+            b[g] = -st[g].mean * a[g];
+        }
+        parallelRanges(n, threads, [&](int lo, int hi, int) {
+            for (int i = lo; i < hi; i++) value[i] = (Score)lround(value[i] * a[group[i]] + b[group[i]]);
+        });
+        return;
+    }
+
+    // : ׷캰  ( ) ׷       ڱ  ̺ Ž
+    vector<int> start(groups + 1, 0);
+    for (int g : group) start[g + 1]++;
+    for (int g = 0; g < groups; g++) start[g + 1] += start[g];
+    vector<Score> sorted(n);
+    {
+        vector<int> pos(start.begin(), start.end() - 1);
+        for (int i = 0; i < n; i++) sorted[pos[group[i]]++] = value[i];
+    }
+    // ū ׷  忡  ʵ ׷  
+    {
+        vector<thread> pool;
+        int gt = min(threads, max(1, groups));
+        for (int t = 0; t < gt; t++) {
+            pool.emplace_back([&, t, gt]() {
+                for (int g = t; g < groups; g += gt) sort(sorted.begin() + start[g], sorted.begin() + start[g + 1]);
+            });
+        }
+        for (thread& th : pool) th.join();
+    }
+    parallelRanges(n, threads, [&](int lo, int hi, int) {
+        for (int i = lo; i < hi; i++) {
+            auto first = sorted.begin() + start[group[i]], last = sorted.begin() + start[group[i] + 1];
+            auto r = equal_range(first, last, value[i]);
+            double below = (double)(r.first - first), eq = (double)(r.second - r.first);
+            value[i] = (Score)lround((below + eq / 2) / (last - first) * PCT_SCALE);
+        }
+    });
+}
+
+void normalizeScores(vector<Video>& videos, NormMode mode, int threads) {
+    vector<int> g = groupIds(videos, &Video::categoryId);
+    vector<Score> s(videos.size());
+    for (size_t i = 0; i < videos.size(); i++) s[i] = videos[i].score;
+    normalizeByGroup(s, g, mode, threads);
+    for (size_t i = 0; i < videos.size(); i++) videos[i].score = s[i];
+}
+
+//  ׷ ӵ  v[0..len)    ȭ
+static void normalizeSlice(Score* v, int len, NormMode mode) {
+    if (mode == Z_SCORE) {
+        GroupStats st;
+        for (int i = 0; i < len; i++) st.add(v[i]);
+        double sd = st.stddev();
+        double a = sd > 0 ? Z_SCALE / sd : 0.0, b = -st.mean * a;
+        for (int i = 0; i < len; i++) v[i] = (Score)lround(v[i] * a + b);
+        return;
+    }
+    vector<Score> sorted(v, v + len);
+    sort(sorted.begin(), sorted.end());
+    for (int i = 0; i < len; i++) {
+        auto r = equal_range(sorted.begin(), sorted.end(), v[i]);
+        double below = (double)(r.first - sorted.begin()), eq = (double)(r.second - r.first);
+        v[i] = (Score)lround((below + eq / 2) / len * PCT_SCALE);
+    }
+}
+
+void normalizeByCategory(VideoTable& t, NormMode mode, int threads) {
+    if (!t.clustered()) normalizeByGroup(t.score, t.category, mode, threads);
+    else {
+        const vector<VideoTable::Range>& rg = t.categoryRanges;
+        int g = (int)rg.size();
+        if (threads <= 0) threads = max(1, (int)thread::hardware_concurrency());
+        threads = min(threads, max(1, g));
+        vector<thread> pool;
+        for (int k = 0; k < threads; k++) {
+            pool.emplace_back([&, k]() {
+                for (int i = k; i < g; i += threads) normalizeSlice(t.score.data() + rg[i].lo, rg[i].hi - rg[i].lo, mode);
+            });
+        }
+        for (thread& th : pool) th.join();
+    }
+    t.touch(VideoTable::SCORE);
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include "Utility.h"
+#include "VideoTable.h"
+
+// ׷(īװ ) /л. Welford    ϰ, 庰 κ ´ Chan  ħ
+struct GroupStats {
+    long long count = 0;
+    double mean = 0;
+    double m2 = 0;// 
+
+    void add(double x);
+    void merge(const GroupStats& o);
+    double variance() const { return count > 1 ? m2 / count : 0.0; }//л
+    double stddev() const { return sqrt(variance()); }
+};
+
+// group[i] 0..groups-1
+vector<GroupStats> groupStats(const vector<Score>& value, const vector<int>& group, int groups, int threads = 0);
+
+enum NormMode {
+    Z_SCORE,//(x - ) / ǥ * Z_SCALE, ǥ 0̸ 0
+    PERCENTILE//׷ ȿ (   +   /2) / ׷ ũ * PCT_SCALE
+};
+const int Z_SCALE = 1000;
+const int PCT_SCALE = 10000;
+
+void normalizeByGroup(vector<Score>& value, const vector<int>& group, NormMode mode, int threads = 0);//value ڸ ٲ
+void normalizeScores(vector<Video>& videos, NormMode mode, int threads = 0);//categoryId score ȭ
+// ̺ score īװ ȭ. cluster() ̸̺ īװ  ״ ߶ ó ( /׷ ȣ ȸ )
+void normalizeByCategory(VideoTable& t, NormMode mode, int threads = 0);
@@ -17,6 +17,18 @@ void Heap::push(const Score& x) {
     siftUp((int)a.size() - 1);
 }
 
+void Heap::pushBatch(const Score* x, int cnt) {
+    if (cnt <= 0) return;
+    int n = (int)a.size();
+    a.insert(a.end(), x, x + cnt);
+    if (cnt > n) heapify();//     ü ٽ  (O(n)) ϳ siftUp 
+    else for (int i = n; i < n + cnt; i++) siftUp(i);
+}
+
+void Heap::pushBatch(const vector<Score>& x) {
+    pushBatch(x.data(), (int)x.size());
+}
+
 void Heap::pop() {
     if (a.empty()) throw out_of_range("pop on empty heap");// ó
     swap(a[0], a.back());
@@ -24,6 +36,20 @@ void Heap::pop() {
     if (!a.empty()) siftDown(0);
 }
 
+void Heap::popBatch(int k, vector<Score>& out) {
+    if (k < 0 || k > (int)a.size()) throw out_of_range("popBatch k out of range");
+    int n = (int)a.size();
+    if (k * 4 < n) {//ݸ   pop k
+        for (int i = 0; i < k; i++) { out.push_back(a[0]); pop(); }
+        return;
+    }
+    //     k κ ؼ    ٽ 
+    partial_sort(a.begin(), a.begin() + k, a.end(), comp);
+    out.insert(out.end(), a.begin(), a.begin() + k);
+    a.erase(a.begin(), a.begin() + k);
+    heapify();
+}
+
 const Score& Heap::top() const {
     if (a.empty()) throw out_of_range("top on empty heap");
     return a[0];
@@ -10,7 +10,10 @@ public:
     explicit Heap(const vector<Score>& data, Mode m = MIN);
 
     void push(const Score& x);
+    void pushBatch(const Score* x, int cnt);//    ֱ, ġ ũ ڿ ̰ heapify  
+    void pushBatch(const vector<Score>& x);
     void pop();
+    void popBatch(int k, vector<Score>& out);// k  out ڿ ̰  
     const Score& top() const;
     bool empty() const;
     int size() const;
@@ -0,0 +1,166 @@
+#include "Utility.h"
+#include "KeyCompress.h"
+
+unsigned KeyCodec::encode(Score x) const {
+    if (ranked) return rankOf.at(x);
+    return (unsigned)((long long)x - base);
+}
+
+Score KeyCodec::decode(unsigned key) const {
+    if (ranked) return dict[key];
+    return (Score)((long long)base + key);
+}
+
+// mn/mx p  ּڰ/ִ̾  (ƴϸ Ű ġǷ ٱ  )
+static KeyCodec makeCodec(const vector<Score>& p, long long mn, long long mx, bool allowRank) {
+    KeyCodec c;
+    c.base = (Score)mn;
+    c.bits = bitWidth((unsigned long long)(mx - mn));
+    c.ranked = false;
+    if (!allowRank || c.bits <= 16) return c;
+
+    //  2^16    ٲ,  ٷ 
+    const size_t limit = 1 << 16;
+    unordered_set<Score> uniq;
+    for (Score x : p) {
+        uniq.insert(x);
+        if (uniq.size() > limit) return c;
+    }
+    int rankBits = bitWidth(uniq.size() - 1);
+    if (rankBits + 4 > c.bits) return c;// Ʈ  ٸ    
+
+    c.dict.assign(uniq.begin(), uniq.end());
+    sort(c.dict.begin(), c.dict.end());
+    c.rankOf.reserve(c.dict.size());
+    for (unsigned i = 0; i < c.dict.size(); i++) c.rankOf[c.dict[i]] = i;
+    c.ranked = true;
+    c.bits = rankBits;
+    return c;
+}
+
+KeyCodec makeCodec(const vector<Score>& p, bool allowRank) {
+    if (p.empty()) return makeCodec(p, 0, 0, allowRank);
+    auto r = minmax_element(p.begin(), p.end());
+    return makeCodec(p, *r.first, *r.second, allowRank);
+}
+
+KeyCodec makeCodec(const VideoTable& t, bool allowRank) {
+    const ColumnStats& st = t.columnStats(VideoTable::SCORE);
+    return makeCodec(t.score, st.mn, st.mx, allowRank);
+}
+
+void encodeKeys(const KeyCodec& c, const vector<Score>& p, vector<unsigned>& out) {
+    int size = (int)p.size();
+    out.resize(size);
+    if (c.ranked) for (int i = 0; i < size; i++) out[i] = c.rankOf.at(p[i]);
+    else for (int i = 0; i < size; i++) out[i] = (unsigned)((long long)p[i] - c.base);
+}
+
+// Ʈ [shift, shift + bits)    LSD   ( )
+// ڸ 11Ʈ Ϸ  īƮ 迭 L1 ĳÿ  
+template <class K>
+static void lsdDescending(vector<K>& a, int shift, int bits) {
+    if (bits <= 0 || a.size() < 2) return;
+    int passes = (bits + 10) / 11;
+    int d = (bits + passes - 1) / passes;
+    int buckets = 1 << d;
+    K mask = (K)(buckets - 1);
+    vector<K> tmp(a.size());
+    vector<int> cnt(buckets);
+    for (int ps = 0; ps < passes; ps++) {
+        int sh = shift + ps * d;
+        fill(cnt.begin(), cnt.end(), 0);
+        for (K x : a) cnt[mask - ((x >> sh) & mask)]++;
+        int sum = 0;
+        for (int b = 0; b < buckets; b++) { int t = cnt[b]; cnt[b] = sum; sum += t; }
+        for (K x : a) tmp[cnt[mask - ((x >> sh) & mask)]++] = x;
+        a.swap(tmp);
+    }
+}
+
+static void radixSortCompressed(vector<Score>& p, const KeyCodec& c) {
+    vector<unsigned> keys;
+    encodeKeys(c, p, keys);
+    lsdDescending(keys, 0, c.bits);//Ű  Ǵ    ٴ ʿ 
+    int size = (int)p.size();
+    for (int i = 0; i < size; i++) p[i] = c.decode(keys[i]);
+}
+
+void radixSortCompressed(vector<Score>& p) {
+    if (p.size() < 2) return;
+    radixSortCompressed(p, makeCodec(p));
+}
+
+void radixSortCompressed(const VideoTable& t, vector<Score>& out) {
+    out = t.score;
+    if (out.size() < 2) return;
+    radixSortCompressed(out, makeCodec(t));
+}
+
+static Score radixSelectCompressed(const vector<Score>& p, int top, const KeyCodec& c) {
+    vector<unsigned> cur, next;
+    encodeKeys(c, p, cur);
+
+    //  ڸ top°  ִ Ŷ  
+    unsigned prefix = 0;
+    int hi = c.bits;
+    while (hi > 0) {
+        int d = min(11, hi);
+        int lo = hi - d;
+        int buckets = 1 << d;
+        unsigned mask = (unsigned)(buckets - 1);
+        vector<int> cnt(buckets, 0);
+        for (unsigned x : cur) cnt[(x >> lo) & mask]++;
+        int b = buckets - 1;
+        while (top >= cnt[b]) { top -= cnt[b]; b--; }
+        prefix |= (unsigned)b << lo;
+        next.clear();
+        for (unsigned x : cur) if (((x >> lo) & mask) == (unsigned)b) next.push_back(x);
+        cur.swap(next);
+        hi = lo;
+    }
+    return c.decode(prefix);
+}
+
+Score radixSelectCompressed(const vector<Score>& p, int top) {
+    if (p.empty()) throw out_of_range("empty vector");
+    if (top < 0 || top >= (int)p.size()) throw out_of_range("k out of range");
+    return radixSelectCompressed(p, top, makeCodec(p));
+}
+
+Score radixSelectCompressed(const VideoTable& t, int top) {
+    if (t.size() == 0) throw out_of_range("empty vector");
+    if (top < 0 || top >= t.size()) throw out_of_range("k out of range");
+    return radixSelectCompressed(t.score, top, makeCodec(t));
+}
+
+template <class K>
+static void argsortPacked(const vector<unsigned>& keys, int keyBits, vector<int>& order) {
+    int size = (int)keys.size();
+    int idxBits = bitWidth((unsigned long long)(size - 1));
+    vector<K> packed(size);
+    for (int i = 0; i < size; i++) packed[i] = ((K)keys[i] << idxBits) | (K)i;
+    lsdDescending(packed, idxBits, keyBits);//ε κ ó ̶ Ű κи ϸ 
+    K idxMask = (K)(((K)1 << idxBits) - 1);
+    order.resize(size);
+    for (int i = 0; i < size; i++) order[i] = (int)(packed[i] & idxMask);
+}
+
+static void argsortCompressed(const vector<Score>& p, vector<int>& order, const KeyCodec& c) {
+    int size = (int)p.size();
+    vector<unsigned> keys;
+    encodeKeys(c, p, keys);
+    int idxBits = bitWidth((unsigned long long)(size - 1));
+    if (c.bits + idxBits <= 32) argsortPacked<unsigned>(keys, c.bits, order);// п 32Ʈ  ӽ 迭 
+    else argsortPacked<unsigned long long>(keys, c.bits, order);
+}
+
+void argsortCompressed(const vector<Score>& p, vector<int>& order) {
+    if (p.empty()) { order.clear(); return; }
+    argsortCompressed(p, order, makeCodec(p));
+}
+
+void argsortCompressed(const VideoTable& t, vector<int>& order) {
+    if (t.size() == 0) { order.clear(); return; }
+    argsortCompressed(t.score, order, makeCodec(t));
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include "Utility.h"
+#include "ColumnStats.h"
+#include "VideoTable.h"
+
+//  ϴ Ű . ּڰ  0 ϰ ϰ ʿ Ʈ  
+//     (0..u-1) Ű Ἥ  .  / н  ӽ 迭 ũⰡ پ
+struct KeyCodec {
+    Score base;//ranked ƴϸ key = x - base
+    int bits;//Ű Ʈ  (0̸   )
+    bool ranked;//dict  Ű 
+    vector<Score> dict;//ranked   ->   ()
+    unordered_map<Score, unsigned> rankOf;//ranked    -> 
+
+    unsigned encode(Score x) const;
+    Score decode(unsigned key) const;
+};
+
+// 踦   :   ּڰ/ִ ϰų, VideoTable̸  Ȯϴ columnStats(SCORE) 
+KeyCodec makeCodec(const vector<Score>& p, bool allowRank = true);
+KeyCodec makeCodec(const VideoTable& t, bool allowRank = true);//t.score
+void encodeKeys(const KeyCodec& c, const vector<Score>& p, vector<unsigned>& out);
+
+void radixSortCompressed(vector<Score>& p);//radixSort  ,  Ű 11Ʈ  ڸ 1~3н
+void radixSortCompressed(const VideoTable& t, vector<Score>& out);//t.score out  
+Score radixSelectCompressed(const vector<Score>& p, int top);//quickSelectó top°(0) ū 
+Score radixSelectCompressed(const VideoTable& t, int top);
+void argsortCompressed(const vector<Score>& p, vector<int>& order);//(, ε)    ,  / ε 
+void argsortCompressed(const VideoTable& t, vector<int>& order);
@@ -0,0 +1,74 @@
+#include "Utility.h"
+#include "LoserTree.h"
+
+LoserTree::LoserTree() : LoserTree(MIN) {}
+
+LoserTree::LoserTree(Mode m) : k(0), live(0) {
+    comp = (m == MAX) ? &greaterfn : &lessfn;
+}
+
+LoserTree::LoserTree(const vector<Score>& heads, Mode m) : LoserTree(m) {
+    build(heads);
+}
+
+bool LoserTree::lessfn(const Score& x, const Score& y) { return x < y; }
+bool LoserTree::greaterfn(const Score& x, const Score& y) { return x > y; }
+
+void LoserTree::build(const vector<Score>& heads) {
+    k = (int)heads.size();
+    live = k;
+    tree.assign(k > 0 ? k : 1, Node{ 0, -1 });
+    if (k == 0) return;
+    if (k == 1) { tree[0] = Node{ heads[0], 0 }; return; }
+
+    //  k..2k-1,   1..k-1 (k 2 ŵ ƴϾ )
+    vector<Node> win(2 * k);
+    for (int s = 0; s < k; s++) win[k + s] = Node{ heads[s], s };
+    for (int i = k - 1; i >= 1; i--) {
+        const Node& l = win[2 * i];
+        const Node& r = win[2 * i + 1];
+        if (beats(l, r)) { win[i] = l; tree[i] = r; }
+        else { win[i] = r; tree[i] = l; }
+    }
+    tree[0] = win[1];
+}
+
+bool LoserTree::beats(const Node& x, const Node& y) const {
+    if ((x.src < 0) != (y.src < 0)) return x.src >= 0;// ҽ ׻ 
+    if (x.src < 0) return x.src > y.src;
+    if (comp(x.key, y.key)) return true;
+    if (comp(y.key, x.key)) return false;
+    return x.src < y.src;// ̸ ȣ  ҽ  ( )
+}
+
+void LoserTree::replay(Node x) {
+    int s = x.src >= 0 ? x.src : -1 - x.src;
+    for (int p = (s + k) / 2; p > 0; p /= 2) {
+        if (beats(tree[p], x)) swap(tree[p], x);
+    }
+    tree[0] = x;
+}
+
+void LoserTree::replaceTop(const Score& x) {
+    if (live == 0) throw out_of_range("replaceTop on empty loser tree");
+    replay(Node{ x, tree[0].src });
+}
+
+void LoserTree::retireTop() {
+    if (live == 0) throw out_of_range("retireTop on empty loser tree");
+    live--;
+    replay(Node{ tree[0].key, -1 - tree[0].src });
+}
+
+const Score& LoserTree::top() const {
+    if (live == 0) throw out_of_range("top on empty loser tree");
+    return tree[0].key;
+}
+
+int LoserTree::topSource() const {
+    if (live == 0) throw out_of_range("topSource on empty loser tree");
+    return tree[0].src;
+}
+
+bool LoserTree::empty() const { return live == 0; }
+int LoserTree::size() const { return live; }
@@ -0,0 +1,38 @@
+#pragma once
+#include "Utility.h"
+
+//  Ʈ(ʸƮ Ʈ). k ҽ ڸ ̰,  ڸ   ٲ 
+// ٽ ڸ ã ۾(k-way merge, ܺ ,  ǵ top-k) log k 񱳷 ó
+class LoserTree {
+public:
+    enum Mode { MIN = -1, MAX = +1 };//Heap  ǹ, MIN̸   
+
+    LoserTree();
+    explicit LoserTree(Mode m);
+    explicit LoserTree(const vector<Score>& heads, Mode m = MIN);//heads[i] = i ҽ ù 
+
+    void build(const vector<Score>& heads);
+    void replaceTop(const Score& x);// ҽ   üϰ  ڸ ã
+    void retireTop();// ҽ    ȣ,  ҽ  ׻ й
+    const Score& top() const;
+    int topSource() const;//ڰ   ҽ
+    bool empty() const;
+    int size() const;//  ִ ҽ 
+
+private:
+    struct Node {
+        Score key;
+        int src;//ҽ ȣ,  ҽ -1 - ȣ ǥ
+    };
+    vector<Node> tree;//tree[0] , tree[1..k-1]  忡  ҽ (   ־   )
+    int k;
+    int live;
+    typedef bool (*Cmp)(const Score&, const Score&);
+    Cmp comp;
+
+    static bool lessfn(const Score& x, const Score& y);
+    static bool greaterfn(const Score& x, const Score& y);
+
+    bool beats(const Node& x, const Node& y) const;//x y ̱ true
+    void replay(Node x);//x  Ʈ ö󰡸 ڸ 
+};
@@ -0,0 +1,137 @@
+#include "Utility.h"
+#include "MinHashLSH.h"
+
+static unsigned long long mix64(unsigned long long x) {//splitmix64  ܰ
+    x ^= x >> 30; x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27; x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+static unsigned long long hashBytes(const char* s, size_t n, unsigned long long salt) {//FNV-1a
+    unsigned long long x = 1469598103934665603ULL ^ salt;
+    for (size_t i = 0; i < n; i++) { x ^= (unsigned char)s[i]; x *= 1099511628211ULL; }
+    return mix64(x);
+}
+
+void videoFeatures(const Video& v, vector<unsigned long long>& out) {
+    out.clear();
+    for (const string& t : v.tags) {
+        string low = normalizeTag(t);
+        out.push_back(hashBytes(low.data(), low.size(), 1));
+    }
+    string title = v.title;
+    for (char& c : title) c = (char)tolower((unsigned char)c);
+    for (size_t i = 0; i + 3 <= title.size(); i++) out.push_back(hashBytes(title.data() + i, 3, 2));
+    sort(out.begin(), out.end());
+    out.erase(unique(out.begin(), out.end()), out.end());
+}
+
+MinHashLSH::MinHashLSH(int bands, int rows) : bands(bands), rows(rows), h(bands * rows), maxScore(0) {
+    if (bands <= 0 || rows <= 0) throw invalid_argument("bands/rows must be positive");
+    seeds.resize(h);
+    for (int j = 0; j < h; j++) seeds[j] = mix64(0x9E3779B97F4A7C15ULL * (j + 1));
+}
+
+void MinHashLSH::signRows(int lo, int hi) {
+    vector<unsigned> m(h);
+    for (int i = lo; i < hi; i++) {
+        fill(m.begin(), m.end(), UINT_MAX);
+        // Ҹ h ؽø xor õ +   ּڰ  (  б  min̶ ȭ)
+        for (unsigned long long f : features[i]) {
+            for (int j = 0; j < h; j++) {
+                unsigned long long x = (f ^ seeds[j]) * 0xff51afd7ed558ccdULL;
+                unsigned v = (unsigned)(x >> 32);
+                m[j] = v < m[j] ? v : m[j];
+            }
+        }
+        copy(m.begin(), m.end(), sig.begin() + (size_t)i * h);
+    }
+}
+
+void MinHashLSH::build(const vector<Video>& videos, int threads) {
+    int n = (int)videos.size();
+    features.assign(n, vector<unsigned long long>());
+    score.resize(n);
+    maxScore = 0;
+    for (int i = 0; i < n; i++) {
+        videoFeatures(videos[i], features[i]);
+        score[i] = videos[i].score;
+        maxScore = max(maxScore, videos[i].score);
+    }
+    sig.assign((size_t)n * h, UINT_MAX);
+
+    //   ೢ ̶   庰 ó
+    if (threads <= 0) threads = max(1, (int)thread::hardware_concurrency());
+    threads = min(threads, max(1, n / 1024));
+    vector<thread> pool;
+    for (int t = 0; t < threads; t++) {
+        int lo = (int)((long long)n * t / threads), hi = (int)((long long)n * (t + 1) / threads);
+        pool.emplace_back(&MinHashLSH::signRows, this, lo, hi);
+    }
+    for (thread& th : pool) th.join();
+
+    buckets.assign(bands, unordered_map<unsigned long long, vector<int>>());
+    for (int i = 0; i < n; i++) {
+        if (features[i].empty()) continue;//±׵    ƹ Ͱ  
+        const unsigned* s = &sig[(size_t)i * h];
+        for (int b = 0; b < bands; b++) {
+            unsigned long long key = (unsigned long long)b;
+            for (int r = 0; r < rows; r++) key = mix64(key ^ s[b * rows + r]);
+            buckets[b][key].push_back(i);
+        }
+    }
+}
+
+double MinHashLSH::estimate(int a, int b) const {
+    const unsigned* x = &sig[(size_t)a * h];
+    const unsigned* y = &sig[(size_t)b * h];
+    int same = 0;
+    for (int j = 0; j < h; j++) same += (x[j] == y[j]);
+    return (double)same / h;
+}
+
+static double exactJaccard(const vector<unsigned long long>& a, const vector<unsigned long long>& b) {
+    size_t i = 0, j = 0, inter = 0;
+    while (i < a.size() && j < b.size()) {
+        if (a[i] < b[j]) i++;
+        else if (a[i] > b[j]) j++;
+        else { inter++; i++; j++; }
+    }
+    size_t uni = a.size() + b.size() - inter;
+    return uni ? (double)inter / uni : 0.0;
+}
+
+vector<pair<int, double>> MinHashLSH::related(int row, int k) const {
+    vector<pair<int, double>> res;
+    if (row < 0 || row >= (int)features.size()) throw out_of_range("row out of range");
+    if (k <= 0 || features[row].empty()) return res;
+
+    // 1)  Ŷ ִ ุ ĺ
+    const unsigned* s = &sig[(size_t)row * h];
+    vector<int> cand;
+    for (int b = 0; b < bands; b++) {
+        unsigned long long key = (unsigned long long)b;
+        for (int r = 0; r < rows; r++) key = mix64(key ^ s[b * rows + r]);
+        auto it = buckets[b].find(key);
+        if (it == buckets[b].end()) continue;
+        cand.insert(cand.end(), it->second.begin(), it->second.end());
+    }
+    sort(cand.begin(), cand.end());
+    cand.erase(unique(cand.begin(), cand.end()), cand.end());
+
+    // 2) ĺ Ȯ ī ٽ ϰ score    (絵  α ִ  )
+    for (int c : cand) {
+        if (c == row) continue;
+        double j = exactJaccard(features[row], features[c]);
+        double pop = maxScore > 0 ? (double)max(0, score[c]) / maxScore : 0.0;
+        res.push_back(make_pair(c, j + 0.1 * pop));
+    }
+    int keep = min(k, (int)res.size());
+    auto better = [](const pair<int, double>& a, const pair<int, double>& b) {
+        return a.second != b.second ? a.second > b.second : a.first < b.first;
+    };
+    partial_sort(res.begin(), res.begin() + keep, res.end(), better);
+    res.resize(keep);
+    return res;
+}
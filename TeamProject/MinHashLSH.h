@@ -0,0 +1,27 @@
+#pragma once
+#include "Utility.h"
+
+//   ã MinHash + LSH 
+// 󸶴 ±׿  3 (shingle)   H ּ ؽ÷   ,
+//   ߶  Ŷ   ĺ  (ü  ϴ O(n^2) )
+class MinHashLSH {
+public:
+    MinHashLSH(int bands = 16, int rows = 4);//  = bands * rows
+
+    void build(const vector<Video>& videos, int threads = 0);//threads 0̸ hardware_concurrency
+    vector<pair<int, double>> related(int row, int k) const;//(, ) , ڱ ڽ 
+    double estimate(int a, int b) const;//  ī 絵
+
+private:
+    int bands, rows, h;
+    vector<unsigned> sig;// i  sig[i*h .. i*h+h-1]
+    vector<unsigned long long> seeds;
+    vector<unordered_map<unsigned long long, vector<int>>> buckets;//庰 ( ؽ ->  )
+    vector<vector<unsigned long long>> features;//ະ  ؽ (, ߺ ),   Ȯ ħ 
+    vector<Score> score;
+    Score maxScore;
+
+    void signRows(int lo, int hi);
+};
+
+void videoFeatures(const Video& v, vector<unsigned long long>& out);//± +  shingle 64Ʈ ؽ 
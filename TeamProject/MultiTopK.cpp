@@ -0,0 +1,23 @@
+#include "Utility.h"
+#include "MultiTopK.h"
+
+MultiTopKResult multiTopK(const VideoTable& t, int k) {
+    int n = t.size();
+    if (k <= 0) throw out_of_range("k out of range");
+
+    TopKBuffer<long long> view(k), like(k), comment(k), score(k);
+    //     ޸𸮸   а ǹǷ  ϳ  ۸  
+    for (int i = 0; i < n; i++) {
+        view.offer(t.viewCount[i], i);
+        like.offer(t.likeCount[i], i);
+        comment.offer(t.commentCount[i], i);
+        score.offer(t.score[i], i);
+    }
+
+    MultiTopKResult r;
+    r.byView = view.finish();
+    r.byLike = like.finish();
+    r.byComment = comment.finish();
+    r.byScore = score.finish();
+    return r;
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "Utility.h"
+#include "VideoTable.h"
+
+// ĿƮ  ϳ (bufferSelect  ,   ȣ  )
+// ĿƮκ ū  ް, 2k   k  ĿƮ ø
+template <class T>
+struct TopKBuffer {
+    vector<pair<T, int>> buf;
+    T cut;
+    bool hasCut;
+    int k;
+
+    explicit TopKBuffer(int k) : cut(T()), hasCut(false), k(k) { buf.reserve(2 * (size_t)k); }
+
+    void offer(T v, int id) {
+        if (hasCut && v <= cut) return;
+        buf.push_back(make_pair(v, id));
+        if ((int)buf.size() == 2 * k) shrink();
+    }
+
+    static bool better(const pair<T, int>& a, const pair<T, int>& b) {// ũ ,   ȣ  
+        return a.first != b.first ? a.first > b.first : a.second < b.second;
+    }
+
+    void shrink() {
+        nth_element(buf.begin(), buf.begin() + (k - 1), buf.end(), better);
+        cut = buf[k - 1].first;
+        buf.resize(k);
+        hasCut = true;
+    }
+
+    vector<int> finish() {//   ȣ 
+        sort(buf.begin(), buf.end(), better);
+        if ((int)buf.size() > k) buf.resize(k);
+        vector<int> ids;
+        ids.reserve(buf.size());
+        for (auto& e : buf) ids.push_back(e.second);
+        return ids;
+    }
+};
+
+// ú: ȸ/ƿ// top-k     
+struct MultiTopKResult {
+    vector<int> byView, byLike, byComment, byScore;//     ȣ (VideoTable )
+};
+
+MultiTopKResult multiTopK(const VideoTable& t, int k);
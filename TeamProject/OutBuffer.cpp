@@ -0,0 +1,127 @@
+#include "Utility.h"
+#include "OutBuffer.h"
+#include "VideoId.h"
+
+static const char DIGITS[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+OutBuffer& OutBuffer::putInt(long long v) {
+    char tmp[20];
+    char* p = tmp + 20;
+    unsigned long long u = v < 0 ? 0ULL - (unsigned long long)v : (unsigned long long)v;//LLONG_MIN ϰ
+    while (u >= 100) {
+        unsigned d = (unsigned)(u % 100) * 2;
+        u /= 100;
+        *--p = DIGITS[d + 1];
+        *--p = DIGITS[d];
+    }
+    if (u >= 10) { *--p = DIGITS[u * 2 + 1]; *--p = DIGITS[u * 2]; }
+    else *--p = (char)('0' + u);
+    if (v < 0) *--p = '-';
+    return put(p, tmp + 20 - p);
+}
+
+// 8Ʈ    ̽ ('"', '\\', 0x20 ̸) ϳ  ״  (SWAR)
+static inline bool cleanWord(unsigned long long x) {
+    const unsigned long long ONES = 0x0101010101010101ULL, HIGH = 0x8080808080808080ULL;
+    unsigned long long q = x ^ (ONES * '"'), b = x ^ (ONES * '\\');
+    unsigned long long hit = ((x - ONES * 0x20) & ~x) | ((q - ONES) & ~q) | ((b - ONES) & ~b);
+    return (hit & HIGH) == 0;
+}
+
+OutBuffer& OutBuffer::putJsonString(const char* s, size_t n) {
+    reserve(n * 6 + 2);// \u00XX Ǵ ־ 
+    char* o = buf.data() + len;
+    *o++ = '"';
+    size_t i = 0;
+    while (i < n) {
+        if (i + 8 <= n) {
+            unsigned long long x;
+            memcpy(&x, s + i, 8);
+            if (cleanWord(x)) { memcpy(o, s + i, 8); o += 8; i += 8; continue; }
+        }
+        unsigned char c = (unsigned char)s[i++];
+        if (c == '"' || c == '\\') { *o++ = '\\'; *o++ = (char)c; }
+        else if (c >= 0x20) *o++ = (char)c;
+        else {
+            *o++ = '\\';
+            switch (c) {
+            case '\n': *o++ = 'n'; break;
+            case '\r': *o++ = 'r'; break;
+            case '\t': *o++ = 't'; break;
+            case '\b': *o++ = 'b'; break;
+            case '\f': *o++ = 'f'; break;
+            default:
+                *o++ = 'u'; *o++ = '0'; *o++ = '0';
+                *o++ = "0123456789abcdef"[c >> 4];
+                *o++ = "0123456789abcdef"[c & 15];
+            }
+        }
+    }
+    *o++ = '"';
+    len = o - buf.data();
+    return *this;
+}
+
+OutBuffer& OutBuffer::putCsvField(const char* s, size_t n) {
+    bool quote = false;
+    for (size_t i = 0; i < n && !quote; i++) quote = s[i] == ',' || s[i] == '"' || s[i] == '\n' || s[i] == '\r';
+    if (!quote) return put(s, n);
+    reserve(n * 2 + 2);
+    char* o = buf.data() + len;
+    *o++ = '"';
+    for (size_t i = 0; i < n; i++) {
+        if (s[i] == '"') *o++ = '"';
+        *o++ = s[i];
+    }
+    *o++ = '"';
+    len = o - buf.data();
+    return *this;
+}
+
+//   ID  ű⼭ Ǯ(ڿ Ҵ ),   ڿ
+static void videoIdOf(const VideoTable& t, const vector<Video>& videos, int r, const char*& s, size_t& n, char* tmp) {
+    if (t.idValid[r]) { unpackVideoId(t.id[r], tmp); s = tmp; n = 11; }
+    else { const string& v = videos[t.row[r]].videoId; s = v.data(); n = v.size(); }
+}
+
+void writeJson(OutBuffer& out, const VideoTable& t, const vector<Video>& videos, const vector<int>& rows) {
+    char idBuf[11];
+    out.put('[');
+    for (size_t k = 0; k < rows.size(); k++) {
+        int r = rows[k];
+        const Video& v = videos[t.row[r]];
+        const char* id;
+        size_t idLen;
+        videoIdOf(t, videos, r, id, idLen, idBuf);
+        if (k) out.put(',');
+        out.put("{\"videoId\":").putJsonString(id, idLen);
+        out.put(",\"title\":").putJsonString(v.title);
+        out.put(",\"channelTitle\":").putJsonString(v.channelTitle);
+        out.put(",\"viewCount\":").putInt(t.viewCount[r]);
+        out.put(",\"likeCount\":").putInt(t.likeCount[r]);
+        out.put(",\"commentCount\":").putInt(t.commentCount[r]);
+        out.put(",\"score\":").putInt(t.score[r]).put('}');
+    }
+    out.put(']');
+}
+
+void writeCsv(OutBuffer& out, const VideoTable& t, const vector<Video>& videos, const vector<int>& rows) {
+    char idBuf[11];
+    out.put("videoId,title,channelTitle,viewCount,likeCount,commentCount,score\n");
+    for (int r : rows) {
+        const Video& v = videos[t.row[r]];
+        const char* id;
+        size_t idLen;
+        videoIdOf(t, videos, r, id, idLen, idBuf);
+        out.putCsvField(id, idLen).put(',');
+        out.putCsvField(v.title).put(',');
+        out.putCsvField(v.channelTitle).put(',');
+        out.putInt(t.viewCount[r]).put(',');
+        out.putInt(t.likeCount[r]).put(',');
+        out.putInt(t.commentCount[r]).put(',');
+        out.putInt(t.score[r]).put('\n');
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include "Utility.h"
+#include "VideoTable.h"
+
+//   . stringstream  char 迭 ٷ 
+// clear()ص 뷮 ״ζ û  ۸ ٽ  Ҵ  Ͼ 
+class OutBuffer {
+public:
+    void clear() { len = 0; }
+    const char* data() const { return buf.data(); }
+    size_t size() const { return len; }
+    string str() const { return string(buf.data(), len); }
+    void writeTo(FILE* f) const { fwrite(buf.data(), 1, len, f); }
+
+    OutBuffer& put(char c) { reserve(1); buf[len++] = c; return *this; }
+    OutBuffer& put(const char* s, size_t n) { reserve(n); if (n) memcpy(buf.data() + len, s, n); len += n; return *this; }// ڿ̸ len == buf.size()   buf[len]  
+    OutBuffer& put(const char* s) { return put(s, strlen(s)); }
+    OutBuffer& put(const string& s) { return put(s.data(), s.size()); }
+    OutBuffer& putInt(long long v);// ڸ ǥ ã ڿ ä
+    OutBuffer& putJsonString(const char* s, size_t n);//ǥ , " \  ̽ (UTF-8 ״)
+    OutBuffer& putJsonString(const string& s) { return putJsonString(s.data(), s.size()); }
+    OutBuffer& putCsvField(const char* s, size_t n);//, " ٹٲ  ǥ ΰ " ""
+    OutBuffer& putCsvField(const string& s) { return putCsvField(s.data(), s.size()); }
+
+private:
+    vector<char> buf;
+    size_t len = 0;
+
+    void reserve(size_t extra) {
+        if (len + extra > buf.size()) buf.resize(max(buf.size() * 2, len + extra + 256));
+    }
+};
+
+// VideoTable rows( top-k ) ٷ .   ڿ t.row  videos 
+void writeJson(OutBuffer& out, const VideoTable& t, const vector<Video>& videos, const vector<int>& rows);
+void writeCsv(OutBuffer& out, const VideoTable& t, const vector<Video>& videos, const vector<int>& rows);//ù  Ӹ
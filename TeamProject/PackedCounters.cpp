@@ -0,0 +1,103 @@
+#include "Utility.h"
+#include "PackedCounters.h"
+#include "KeyCompress.h"
+
+void PackedCounters::build(const VideoTable& t, bool byScore) {
+    n = t.size();
+    order.clear();
+    if (byScore) argsortCompressed(t, order);
+    const vector<long long>* src[COUNTERS] = { &t.viewCount, &t.likeCount, &t.commentCount };
+
+    int nb = (n + BLOCK - 1) / BLOCK;
+    blocks.assign(nb, Block());
+    vector<long long> v(BLOCK), d(BLOCK);
+    for (int b = 0; b < nb; b++) {
+        int lo = b * BLOCK, len = min(n, lo + BLOCK) - lo;
+        for (int c = 0; c < COUNTERS; c++) {
+            for (int i = 0; i < len; i++) v[i] = (*src[c])[tableRow(lo + i)];
+            Block& bl = blocks[b];
+            bl.first[c] = v[0];
+            bl.maxValue[c] = *max_element(v.begin(), v.begin() + len);
+            for (int i = 1; i < len; i++) d[i - 1] = v[i] - v[i - 1];
+            PackedColumn plain, diff;
+            plain.pack(v.data(), len);
+            diff.pack(d.data(), len - 1);
+            bl.delta[c] = diff.words.size() < plain.words.size();
+            bl.col[c] = bl.delta[c] ? move(diff) : move(plain);
+        }
+    }
+}
+
+void PackedCounters::decode(int b, int c, long long* out) const {
+    const Block& bl = blocks[b];
+    int len = min(n, (b + 1) * BLOCK) - b * BLOCK;
+    if (!bl.delta[c]) { bl.col[c].unpack(0, len, out); return; }
+    out[0] = bl.first[c];
+    bl.col[c].unpack(0, len - 1, out + 1);
+    for (int i = 1; i < len; i++) out[i] += out[i - 1];
+}
+
+long long PackedCounters::get(VideoTable::Column c, int pos) const {
+    if (c < 0 || c >= COUNTERS) throw invalid_argument("not a counter column");
+    if (pos < 0 || pos >= n) throw out_of_range("pos out of range");
+    const Block& bl = blocks[pos / BLOCK];
+    int j = pos % BLOCK;
+    if (!bl.delta[c]) return bl.col[c].get(j);
+    long long x = bl.first[c];
+    for (int i = 0; i < j; i++) x += bl.col[c].get(i);
+    return x;
+}
+
+void PackedCounters::weightedScores(long long wv, long long wl, long long wc, vector<long long>& out) const {
+    out.assign(n, 0);
+    long long buf[COUNTERS][BLOCK];
+    const long long w[COUNTERS] = { wv, wl, wc };
+    for (int b = 0; b < (int)blocks.size(); b++) {
+        int lo = b * BLOCK, len = min(n, lo + BLOCK) - lo;
+        for (int c = 0; c < COUNTERS; c++) decode(b, c, buf[c]);
+        for (int i = 0; i < len; i++) out[tableRow(lo + i)] = w[0] * buf[0][i] + w[1] * buf[1][i] + w[2] * buf[2][i];
+    }
+}
+
+vector<int> PackedCounters::topK(int k, long long wv, long long wl, long long wc, int* scannedBlocks) const {
+    if (k <= 0 || k > n) throw out_of_range("k out of range");
+    if (wv < 0 || wl < 0 || wc < 0) throw invalid_argument("weights must be non-negative");
+    const long long w[COUNTERS] = { wv, wl, wc };
+    int nb = (int)blocks.size();
+    vector<pair<long long, int>> ub(nb);//   
+    for (int b = 0; b < nb; b++) {
+        long long u = 0;
+        for (int c = 0; c < COUNTERS; c++) u += w[c] * blocks[b].maxValue[c];
+        ub[b] = make_pair(u, b);
+    }
+    sort(ub.begin(), ub.end(), greater<pair<long long, int>>());
+
+    priority_queue<pair<long long, int>, vector<pair<long long, int>>, greater<pair<long long, int>>> heap;//(, -)
+    long long buf[COUNTERS][BLOCK];
+    int scanned = 0;
+    for (int x = 0; x < nb; x++) {
+        if ((int)heap.size() == k && ub[x].first < heap.top().first) break;
+        int b = ub[x].second, lo = b * BLOCK, len = min(n, lo + BLOCK) - lo;
+        for (int c = 0; c < COUNTERS; c++) decode(b, c, buf[c]);
+        scanned++;
+        for (int i = 0; i < len; i++) {
+            pair<long long, int> e(w[0] * buf[0][i] + w[1] * buf[1][i] + w[2] * buf[2][i], -tableRow(lo + i));
+            if ((int)heap.size() < k) heap.push(e);
+            else if (e > heap.top()) { heap.pop(); heap.push(e); }
+        }
+    }
+    if (scannedBlocks) *scannedBlocks = scanned;
+    vector<int> rows;
+    while (!heap.empty()) { rows.push_back(-heap.top().second); heap.pop(); }
+    reverse(rows.begin(), rows.end());
+    return rows;
+}
+
+size_t PackedCounters::memoryBytes() const {
+    size_t s = order.size() * sizeof(int);
+    for (const Block& b : blocks) {
+        s += sizeof(Block);
+        for (int c = 0; c < COUNTERS; c++) s += b.col[c].words.size() * sizeof(unsigned long long);
+    }
+    return s;
+}
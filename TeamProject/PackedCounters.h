@@ -0,0 +1,39 @@
+#pragma once
+#include "Utility.h"
+#include "VideoTable.h"
+#include "BitPack.h"
+
+// VideoTable ȸ/ƿ/  BLOCK྿  б  纻
+// ϸ FOR(ּڰ ) delta+FOR(  )    Ʈ ŷϰ,
+//  /top-k  ϳ  ۿ Ǯڸ ٷ Ἥ ü  Ǯ  
+class PackedCounters {
+public:
+    static const int BLOCK = 1024;
+    static const int COUNTERS = 3;//VideoTable::VIEW, LIKE, COMMENT
+
+    void build(const VideoTable& t, bool byScore = false);//byScore:   ġ(    ۰ )
+    int size() const { return n; }
+    int tableRow(int pos) const { return order.empty() ? pos : order[pos]; }
+    long long get(VideoTable::Column c, int pos) const;//ϳ   (delta ̸  պ )
+
+    // wv*ȸ + wl*ƿ + wc*, out ̺  
+    void weightedScores(long long wv, long long wl, long long wc, vector<long long>& out) const;
+    //    k ̺  (,   ). ġ 0 ̻̾ ϰ,  ִ  Ѵ  ǳʶ
+    vector<int> topK(int k, long long wv, long long wl, long long wc, int* scannedBlocks = nullptr) const;
+
+    size_t memoryBytes() const;
+    size_t rawBytes() const { return (size_t)n * COUNTERS * sizeof(long long); }//    ũ
+
+private:
+    struct Block {
+        PackedColumn col[COUNTERS];
+        bool delta[COUNTERS];//true col  °  , ù  first
+        long long first[COUNTERS];
+        long long maxValue[COUNTERS];
+    };
+    int n = 0;
+    vector<Block> blocks;
+    vector<int> order;//ġ  ġ -> ̺  (   )
+
+    void decode(int b, int c, long long* out) const;
+};
@@ -0,0 +1,173 @@
+#include "Utility.h"
+#include "PairingHeap.h"
+
+int HeapPool::alloc(const Score& x) {
+    int i;
+    if (!freeList.empty()) { i = freeList.back(); freeList.pop_back(); }
+    else { i = (int)nodes.size(); nodes.push_back(Node()); }
+    nodes[i] = Node{ x, -1, -1, -1 };
+    return i;
+}
+
+void HeapPool::release(int i) { freeList.push_back(i); }
+
+shared_ptr<HeapPool> HeapPool::shared() {
+    static shared_ptr<HeapPool> pool = make_shared<HeapPool>();
+    return pool;
+}
+
+PairingHeap::PairingHeap() : PairingHeap(MIN) {}
+
+PairingHeap::PairingHeap(Mode m) : PairingHeap(HeapPool::shared(), m) {}
+
+PairingHeap::PairingHeap(shared_ptr<HeapPool> pool, Mode m) : p(pool), root(-1), n(0) {
+    comp = (m == MAX) ? &greaterfn : &lessfn;
+}
+
+PairingHeap::PairingHeap(PairingHeap&& other)
+    : p(other.p), root(other.root), n(other.n), comp(other.comp) {
+    other.root = -1; other.n = 0;
+}
+
+PairingHeap& PairingHeap::operator=(PairingHeap&& other) {
+    if (this == &other) return *this;
+    clear();//  ִ  Ǯ ݳ
+    p = other.p; root = other.root; n = other.n; comp = other.comp;
+    other.root = -1; other.n = 0;
+    return *this;
+}
+
+PairingHeap::~PairingHeap() { clear(); }
+
+void PairingHeap::clear() {
+    if (root == -1) return;
+    //    鼭 带  ݳ
+    vector<int> st(1, root);
+    while (!st.empty()) {
+        int v = st.back(); st.pop_back();
+        for (int c = p->nodes[v].child; c != -1; c = p->nodes[c].next) st.push_back(c);
+        p->release(v);
+    }
+    root = -1; n = 0;
+}
+
+bool PairingHeap::lessfn(const Score& x, const Score& y) { return x < y; }
+bool PairingHeap::greaterfn(const Score& x, const Score& y) { return x > y; }
+
+int PairingHeap::link(int a, int b) {
+    if (a == -1) return b;
+    if (b == -1) return a;
+    vector<HeapPool::Node>& t = p->nodes;
+    if (comp(t[b].key, t[a].key)) swap(a, b);
+    // b a   ڽ 
+    t[b].prev = a;
+    t[b].next = t[a].child;
+    if (t[a].child != -1) t[t[a].child].prev = b;
+    t[a].child = b;
+    t[a].next = t[a].prev = -1;
+    return a;
+}
+
+PairingHeap::Handle PairingHeap::push(const Score& x) {
+    int v = p->alloc(x);
+    root = link(root, v);
+    n++;
+    return v;
+}
+
+void PairingHeap::pop() {
+    if (root == -1) throw out_of_range("pop on empty pairing heap");
+    vector<HeapPool::Node>& t = p->nodes;
+
+    // 1ܰ: ڽĵ ʺ   
+    pairs.clear();
+    int c = t[root].child;
+    while (c != -1) {
+        int a = c, b = t[a].next;
+        c = (b != -1) ? t[b].next : -1;
+        t[a].next = t[a].prev = -1;
+        if (b != -1) t[b].next = t[b].prev = -1;
+        pairs.push_back(link(a, b));
+    }
+    // 2ܰ:   ϳ ħ
+    int r = -1;
+    for (int i = (int)pairs.size() - 1; i >= 0; i--) r = link(pairs[i], r);
+
+    p->release(root);
+    root = r;
+    n--;
+}
+
+const Score& PairingHeap::top() const {
+    if (root == -1) throw out_of_range("top on empty pairing heap");
+    return p->nodes[root].key;
+}
+
+bool PairingHeap::empty() const { return root == -1; }
+int PairingHeap::size() const { return n; }
+
+const Score& PairingHeap::value(Handle h) const { return p->nodes[h].key; }
+
+shared_ptr<HeapPool> PairingHeap::pool() const { return p; }
+
+PairingHeap::Mode PairingHeap::mode() const { return comp == &greaterfn ? MAX : MIN; }
+
+void PairingHeap::decreaseKey(Handle h, const Score& x) {
+    vector<HeapPool::Node>& t = p->nodes;
+    if (comp(t[h].key, x)) throw invalid_argument("decreaseKey moves key backwards");
+    t[h].key = x;
+    if (h == root) return;
+
+    // θ(Ǵ  ) ߶  Ʈ ٽ ħ
+    int pv = t[h].prev, nx = t[h].next;
+    if (t[pv].child == h) t[pv].child = nx;
+    else t[pv].next = nx;
+    if (nx != -1) t[nx].prev = pv;
+    t[h].prev = t[h].next = -1;
+    root = link(root, h);
+}
+
+void PairingHeap::copyFrom(const PairingHeap& other, int i) {
+    vector<int> st(1, i);
+    while (!st.empty()) {
+        int v = st.back(); st.pop_back();
+        for (int c = other.p->nodes[v].child; c != -1; c = other.p->nodes[c].next) st.push_back(c);
+        push(other.p->nodes[v].key);
+    }
+}
+
+void PairingHeap::meld(PairingHeap& other) {
+    if (this == &other || other.root == -1) return;
+    if (comp != other.comp) throw invalid_argument("meld of heaps with different modes");
+    if (p == other.p) {
+        root = link(root, other.root);
+        n += other.n;
+        other.root = -1; other.n = 0;
+        return;
+    }
+    copyFrom(other, other.root);
+    other.clear();
+}
+
+PairingHeap meldAll(vector<PairingHeap>& heaps) {
+    if (heaps.empty()) return PairingHeap();
+    PairingHeap all(move(heaps[0]));
+    for (size_t i = 1; i < heaps.size(); i++) all.meld(heaps[i]);
+    return all;
+}
+
+vector<PairingHeap> regroup(vector<PairingHeap>& heaps, const vector<int>& groupOf, int groups) {
+    if (groupOf.size() != heaps.size()) throw invalid_argument("groupOf size mismatch");
+    vector<PairingHeap> out;
+    vector<char> used(groups, 0);
+    shared_ptr<HeapPool> pool = heaps.empty() ? HeapPool::shared() : heaps[0].pool();
+    PairingHeap::Mode m = heaps.empty() ? PairingHeap::MIN : heaps[0].mode();
+    for (int g = 0; g < groups; g++) out.push_back(PairingHeap(pool, m));
+    for (size_t i = 0; i < heaps.size(); i++) {
+        int g = groupOf[i];
+        if (g < 0 || g >= groups) throw out_of_range("group out of range");
+        if (!used[g]) { out[g] = move(heaps[i]); used[g] = 1; }//ù  ״ Űܼ Ǯ 带 
+        else out[g].meld(heaps[i]);
+    }
+    return out;
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "Utility.h"
+
+// PairingHeap 带 Ƶδ Ǯ. 帶 new  ʰ vector ϳ   ݳѴ
+//  Ǯ    ȣ ״ ϹǷ meld O(1)
+struct HeapPool {
+    struct Node {
+        Score key;
+        int child;//  ڽ
+        int next;// 
+        int prev;// ,   ڽ̸ θ (decreaseKey ߶  )
+    };
+    vector<Node> nodes;
+    vector<int> freeList;
+
+    int alloc(const Score& x);
+    void release(int i);
+
+    static shared_ptr<HeapPool> shared();//Ǯ      ⺻ Ǯ (帶   Ǯ   ѱ )
+};
+
+//   (pairing heap). īװ 带 ġų ٽ   Ҹ ϳ ű ʾƵ 
+class PairingHeap {
+public:
+    enum Mode { MIN = -1, MAX = +1 };
+    typedef int Handle;//push ִ  ȣ, decreaseKey/value 
+
+    PairingHeap();
+    explicit PairingHeap(Mode m);//HeapPool::shared() , ׷    O(1) meld
+    PairingHeap(shared_ptr<HeapPool> pool, Mode m = MIN);//Ǯ ϸ  O(1) meld 
+    PairingHeap(PairingHeap&& other);
+    PairingHeap& operator=(PairingHeap&& other);
+    PairingHeap(const PairingHeap&) = delete;//带  Ű ǹǷ  
+    PairingHeap& operator=(const PairingHeap&) = delete;
+    ~PairingHeap();
+
+    Handle push(const Score& x);
+    void pop();
+    const Score& top() const;
+    bool empty() const;
+    int size() const;
+
+    void decreaseKey(Handle h, const Score& x);//MIN̸  ۰, MAX  ũԸ ٲ  
+    const Score& value(Handle h) const;
+    void meld(PairingHeap& other);//other . Ǯ ٸ other Ҹ (O(m)), ̶ other Handle ȿ
+    shared_ptr<HeapPool> pool() const;
+    Mode mode() const;
+
+private:
+    shared_ptr<HeapPool> p;
+    int root;
+    int n;
+    typedef bool (*Cmp)(const Score&, const Score&);
+    Cmp comp;
+    vector<int> pairs;//pop  ӽ 迭, Ź Ҵ ʵ  
+
+    static bool lessfn(const Score& x, const Score& y);
+    static bool greaterfn(const Score& x, const Score& y);
+
+    int link(int a, int b);// Ʈ ļ  Ʈ ȯ
+    void copyFrom(const PairingHeap& other, int i);
+    void clear();//带  Ǯ ݳ
+};
+
+PairingHeap meldAll(vector<PairingHeap>& heaps);//heaps   ģ  ȯ
+vector<PairingHeap> regroup(vector<PairingHeap>& heaps, const vector<int>& groupOf, int groups);//heaps[i] groupOf[i] ׷ ħ,  ׷ heaps[0] Ǯ/ 
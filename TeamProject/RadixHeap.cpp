@@ -0,0 +1,87 @@
+#include "Utility.h"
+#include "RadixHeap.h"
+
+RadixHeap::RadixHeap() : RadixHeap(MIN) {}
+
+RadixHeap::RadixHeap(Mode m) : last(0), n(0), isMax(m == MAX) {}
+
+RadixHeap::RadixHeap(const vector<Score>& data, Mode m) : RadixHeap(m) {
+    for (Score x : data) push(x);
+}
+
+unsigned RadixHeap::keyOf(Score x) const {
+    unsigned u = (unsigned)x ^ 0x80000000u;//ȣ Ʈ  int  unsigned  
+    return isMax ? ~u : u;
+}
+
+void RadixHeap::push(const Score& x) {
+    unsigned u = keyOf(x);
+    if (u < last) throw invalid_argument("radix heap push breaks monotone order");
+    bucket[bitWidth(u ^ last)].push_back(x);
+    n++;
+}
+
+void RadixHeap::pull() const {
+    if (!bucket[0].empty()) return;
+    int i = 1;
+    while (bucket[i].empty()) i++;
+
+    unsigned mn = keyOf(bucket[i][0]);
+    for (Score x : bucket[i]) mn = min(mn, keyOf(x));
+    last = mn;
+    //  ذ Ʈ  i ۾Ƿ ׻   Ŷθ ̵
+    for (Score x : bucket[i]) bucket[bitWidth(keyOf(x) ^ last)].push_back(x);
+    bucket[i].clear();
+}
+
+void RadixHeap::pop() {
+    if (n == 0) throw out_of_range("pop on empty radix heap");
+    pull();
+    bucket[0].pop_back();
+    n--;
+}
+
+const Score& RadixHeap::top() const {
+    if (n == 0) throw out_of_range("top on empty radix heap");
+    pull();
+    return bucket[0].back();
+}
+
+bool RadixHeap::empty() const { return n == 0; }
+int RadixHeap::size() const { return n; }
+
+BucketQueue::BucketQueue(Score lo, Score hi, Mode m) : lo(lo), curValue(0), n(0), isMax(m == MAX) {
+    if (hi < lo) throw invalid_argument("bucket queue range");
+    cnt.assign((size_t)((long long)hi - lo + 1), 0);
+    cur = isMax ? (int)cnt.size() - 1 : 0;
+}
+
+void BucketQueue::push(const Score& x) {
+    long long idx = (long long)x - lo;
+    if (idx < 0 || idx >= (long long)cnt.size()) throw out_of_range("bucket queue push out of range");
+    cnt[(size_t)idx]++;
+    n++;
+    if (isMax ? idx > cur : idx < cur) cur = (int)idx;
+}
+
+void BucketQueue::seek() const {
+    if (isMax) while (cnt[cur] == 0) cur--;
+    else while (cnt[cur] == 0) cur++;
+}
+
+void BucketQueue::pop() {
+    if (n == 0) throw out_of_range("pop on empty bucket queue");
+    seek();
+    cnt[cur]--;
+    n--;
+}
+
+const Score& BucketQueue::top() const {
+    if (n == 0) throw out_of_range("top on empty bucket queue");
+    seek();
+    curValue = lo + cur;
+    return curValue;
+}
+
+bool BucketQueue::empty() const { return n == 0; }
+int BucketQueue::size() const { return n; }
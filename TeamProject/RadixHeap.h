@@ -0,0 +1,54 @@
+#pragma once
+#include "Utility.h"
+
+//   (MIN̸ , MAX )   . Heap Լ ̸ Ƽ ״ ٲ   
+//    xor  ֻ Ʈ Ŷ ,  ϳ ִ 32 Ŷ ű
+class RadixHeap {
+public:
+    enum Mode { MIN = -1, MAX = +1 };
+
+    RadixHeap();
+    explicit RadixHeap(Mode m);
+    explicit RadixHeap(const vector<Score>& data, Mode m = MIN);
+
+    void push(const Score& x);//   ռ ̸ invalid_argument
+    void pop();
+    const Score& top() const;
+    bool empty() const;
+    int size() const;
+
+private:
+    static const int BUCKETS = 33;//xor  Ʈ  0..32
+    mutable vector<Score> bucket[BUCKETS];//top() й谡 Ͼ mutable
+    mutable unsigned last;//   Ű
+    int n;
+    bool isMax;
+
+    unsigned keyOf(Score x) const;//忡  " " ȣ  Ű ٲ
+    void pull() const;//bucket[0]    Ŷ Ǯ ä
+};
+
+//   [lo, hi]     Ŷ ť.    Ŀ  θ 
+//  ƴ push ޾ (Ŀ ǵ),    O(1)
+class BucketQueue {
+public:
+    enum Mode { MIN = -1, MAX = +1 };
+
+    BucketQueue(Score lo, Score hi, Mode m = MIN);
+
+    void push(const Score& x);// ̸ out_of_range
+    void pop();
+    const Score& top() const;
+    bool empty() const;
+    int size() const;
+
+private:
+    vector<int> cnt;//cnt[v - lo] =  v 
+    Score lo;
+    mutable int cur;// ڰ   ִ ġ (MIN̸  , MAX Ʒ)
+    mutable Score curValue;
+    int n;
+    bool isMax;
+
+    void seek() const;
+};
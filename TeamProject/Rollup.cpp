@@ -0,0 +1,242 @@
+#include "Utility.h"
+#include "Rollup.h"
+
+static long long metricOf(const Video& v, int m) {
+    return m == R_VIEW ? v.viewCount : (m == R_LIKE ? v.likeCount : v.commentCount);
+}
+
+void Rollup::Column::pack(const vector<long long>& v) {
+    n = (int)v.size();
+    vector<long long> r, x;
+    for (int i = 0; i < n; i++) if (v[i] != 0) { r.push_back(i); x.push_back(v[i]); }
+    rows.pack(r.data(), (int)r.size());
+    vals.pack(x.data(), (int)x.size());
+    sparse = true;
+    size_t sb = (rows.words.size() + vals.words.size()) * sizeof(unsigned long long);
+    if ((size_t)((n + BLOCK - 1) / BLOCK) * sizeof(PackedColumn) >= sb) return;// Ӹε  ũ  ġ   
+    blocks.resize((n + BLOCK - 1) / BLOCK);
+    size_t dense = 0;
+    for (int b = 0; b < (int)blocks.size(); b++) {
+        int lo = b * BLOCK;
+        blocks[b].pack(v.data() + lo, min(BLOCK, n - lo));
+        dense += blocks[b].bytes();
+    }
+    if (dense < sb) {
+        sparse = false;
+        rows = PackedColumn();
+        vals = PackedColumn();
+    }
+    else blocks.clear();
+}
+
+long long Rollup::Column::get(int i) const {
+    if (i >= n) return 0;
+    if (!sparse) return blocks[i / BLOCK].get(i % BLOCK);
+    int lo = 0, hi = rows.n;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (rows.get(mid) < i) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo < rows.n && rows.get(lo) == i ? vals.get(lo) : 0;
+}
+
+void Rollup::Column::addTo(int lo, int hi, long long* acc) const {
+    hi = min(hi, n);
+    if (lo >= hi) return;
+    if (!sparse) {
+        for (int b = lo / BLOCK; b * BLOCK < hi; b++) {
+            int a = max(lo, b * BLOCK), e = min(hi, (b + 1) * BLOCK);
+            blocks[b].addTo(a - b * BLOCK, e - b * BLOCK, acc + (a - lo));
+        }
+        return;
+    }
+    int k = 0, r = rows.n;
+    while (k < r) {
+        int mid = (k + r) / 2;
+        if (rows.get(mid) < lo) k = mid + 1;
+        else r = mid;
+    }
+    for (; k < rows.n; k++) {
+        int i = (int)rows.get(k);
+        if (i >= hi) break;
+        acc[i - lo] += vals.get(k);
+    }
+}
+
+size_t Rollup::Column::bytes() const {
+    size_t s = sizeof(*this) + (rows.words.size() + vals.words.size()) * sizeof(unsigned long long);
+    for (const PackedColumn& b : blocks) s += b.bytes();
+    return s;
+}
+
+Rollup::Rollup(int hourlyRetention) : retention(hourlyRetention) {
+    if (hourlyRetention < 0) throw invalid_argument("retention must be non-negative");
+}
+
+void Rollup::seal() {
+    if (openStart == LLONG_MIN) return;
+    Bucket b;
+    b.start = openStart;
+    for (int m = 0; m < R_METRICS; m++) {
+        b.video[m].pack(openVideo[m]);
+        b.channel[m].pack(openChannel[m]);
+    }
+    level[HOURLY].closed.push_back(move(b));
+    openStart = LLONG_MIN;
+}
+
+//  ð day   ð Ŷ(= ׳ ð Ŷ)   Ŷ ϳ 
+void Rollup::fold(long long day) {
+    const deque<Bucket>& hours = level[HOURLY].closed;
+    int n = (int)channelRow.size(), ch = (int)channelOf.size();
+    Bucket d;
+    d.start = day;
+    vector<long long> acc;
+    for (int m = 0; m < R_METRICS; m++) {
+        acc.assign(n, 0);
+        for (auto it = hours.rbegin(); it != hours.rend() && it->start >= day; ++it) it->video[m].addTo(0, n, acc.data());
+        d.video[m].pack(acc);
+        acc.assign(ch, 0);
+        for (auto it = hours.rbegin(); it != hours.rend() && it->start >= day; ++it) it->channel[m].addTo(0, ch, acc.data());
+        d.channel[m].pack(acc);
+    }
+    level[DAILY].closed.push_back(move(d));
+}
+
+// ̹  Ŷ   ð Ŷ   Ⱓ   
+void Rollup::trim() {
+    deque<Bucket>& hours = level[HOURLY].closed;
+    long long today = dayOf(openStart);
+    long long keep = openStart - (long long)retention * level[HOURLY].width;
+    while (!hours.empty() && hours.front().start < today && hours.front().start < keep) hours.pop_front();
+}
+
+void Rollup::addCycle(long long t, const vector<Video>& videos) {
+    int n = (int)videos.size();
+    int old = (int)channelRow.size();
+    if (n < old) throw invalid_argument("rows cannot disappear between cycles");
+    long long start = floorDiv(t, level[HOURLY].width) * level[HOURLY].width;
+    if (openStart != LLONG_MIN && start < openStart) throw invalid_argument("rollup time went backwards");
+
+    channelRow.resize(n);
+    for (int i = old; i < n; i++) {
+        auto it = channelOf.emplace(videos[i].channelId, (int)channelOf.size()).first;
+        channelRow[i] = it->second;
+    }
+    for (int m = 0; m < R_METRICS; m++) last[m].resize(n, -1);
+    int ch = (int)channelOf.size();
+
+    if (start != openStart) {
+        long long prevDay = openStart == LLONG_MIN ? LLONG_MIN : dayOf(openStart);
+        seal();
+        if (prevDay != LLONG_MIN && dayOf(start) != prevDay) fold(prevDay);
+        openStart = start;
+        for (int m = 0; m < R_METRICS; m++) {
+            openVideo[m].assign(n, 0);
+            openChannel[m].assign(ch, 0);
+        }
+        trim();
+    }
+    else {
+        for (int m = 0; m < R_METRICS; m++) {
+            openVideo[m].resize(n, 0);
+            openChannel[m].resize(ch, 0);
+        }
+    }
+
+    for (int m = 0; m < R_METRICS; m++) {
+        for (int i = 0; i < n; i++) {
+            long long v = metricOf(videos[i], m);
+            long long d = last[m][i] < 0 ? 0 : v - last[m][i];//ó   ذ 
+            last[m][i] = v;
+            if (d == 0) continue;
+            openVideo[m][i] += d;
+            openChannel[m][channelRow[i]] += d;
+        }
+    }
+}
+
+//  ð [t0, t1) Ŷ  ͺ ʷ f(start,  Ŷ  Ǵ  ð Ŷ̸ nullptr)
+// DAILY      ð Ŷ  Ŷ    ð ѱ
+template <typename F>
+void Rollup::visit(RollupLevel lv, long long t0, long long t1, F f) const {
+    const deque<Bucket>& closed = level[lv].closed;
+    auto it = lower_bound(closed.begin(), closed.end(), t0, [](const Bucket& b, long long t) { return b.start < t; });
+    for (; it != closed.end() && it->start < t1; ++it) f(it->start, &*it);
+    if (openStart == LLONG_MIN) return;
+    if (lv == HOURLY) {
+        if (openStart >= t0 && openStart < t1) f(openStart, (const Bucket*)nullptr);
+        return;
+    }
+    long long today = dayOf(openStart);
+    if (today < t0 || today >= t1) return;
+    const deque<Bucket>& hours = level[HOURLY].closed;
+    auto h = lower_bound(hours.begin(), hours.end(), today, [](const Bucket& b, long long t) { return b.start < t; });
+    for (; h != hours.end(); ++h) f(today, &*h);
+    f(today, (const Bucket*)nullptr);
+}
+
+long long Rollup::rangeSum(RollupLevel lv, RollupMetric m, int row, long long t0, long long t1) const {
+    if (row < 0 || row >= (int)channelRow.size()) throw out_of_range("row out of range");
+    long long s = 0;
+    visit(lv, t0, t1, [&](long long, const Bucket* b) {
+        s += !b ? openVideo[m][row] : b->video[m].get(row);
+    });
+    return s;
+}
+
+long long Rollup::channelRangeSum(RollupLevel lv, RollupMetric m, const string& channelId, long long t0, long long t1) const {
+    auto c = channelOf.find(channelId);
+    if (c == channelOf.end()) return 0;
+    int id = c->second;
+    long long s = 0;
+    visit(lv, t0, t1, [&](long long, const Bucket* b) {
+        if (!b) s += id < (int)openChannel[m].size() ? openChannel[m][id] : 0;
+        else s += b->channel[m].get(id);
+    });
+    return s;
+}
+
+void Rollup::series(RollupLevel lv, RollupMetric m, int row, long long t0, long long t1, vector<pair<long long, long long>>& out) const {
+    if (row < 0 || row >= (int)channelRow.size()) throw out_of_range("row out of range");
+    out.clear();
+    visit(lv, t0, t1, [&](long long start, const Bucket* b) {
+        long long v = !b ? openVideo[m][row] : b->video[m].get(row);
+        if (!out.empty() && out.back().first == start) out.back().second += v;//    ĭ
+        else out.push_back(make_pair(start, v));
+    });
+}
+
+void Rollup::rangeSums(RollupLevel lv, RollupMetric m, long long t0, long long t1, vector<long long>& out, int threads) const {
+    int n = (int)channelRow.size();
+    out.assign(n, 0);
+    vector<const Bucket*> picked;
+    bool open = false;
+    visit(lv, t0, t1, [&](long long, const Bucket* b) { if (b) picked.push_back(b); else open = true; });
+
+    //   庰 ,    Ŷ  ڱ   Ǯ 
+    if (threads <= 0) threads = max(1, (int)thread::hardware_concurrency());
+    threads = min(threads, max(1, n / 16384));
+    auto work = [&](int lo, int hi) {
+        for (const Bucket* b : picked) b->video[m].addTo(lo, hi, out.data() + lo);
+        if (open) for (int i = lo; i < hi; i++) out[i] += openVideo[m][i];
+    };
+    if (threads == 1) { work(0, n); return; }
+    vector<thread> pool;
+    for (int t = 0; t < threads; t++) {
+        int lo = (int)((long long)n * t / threads), hi = (int)((long long)n * (t + 1) / threads);
+        pool.emplace_back(work, lo, hi);
+    }
+    for (thread& th : pool) th.join();
+}
+
+size_t Rollup::memoryBytes() const {
+    size_t s = channelRow.size() * sizeof(int);
+    for (int m = 0; m < R_METRICS; m++) s += (last[m].size() + openVideo[m].size() + openChannel[m].size()) * sizeof(long long);
+    for (const auto& e : channelOf) s += e.first.size() + sizeof(int);
+    for (int l = 0; l < R_LEVELS; l++)
+        for (const Bucket& b : level[l].closed)
+            for (int m = 0; m < R_METRICS; m++) s += b.video[m].bytes() + b.channel[m].bytes();
+    return s;
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include "Utility.h"
+#include "BitPack.h"
+
+//  ֱ⸶  ȸ/ƿ/   ð/  Ŷ  , äκ 
+// ð Ŷ ϳ   Ŷ ( ŭ Ǵ ä ŭ) ŷؼ ݰ, Ϸ簡  ׳ ð Ŷ  Ŷ ϳ 
+// "90  Ϻ ȸ "   90  ϳ  ǰ,    ٽ  
+enum RollupMetric { R_VIEW, R_LIKE, R_COMMENT, R_METRICS };
+enum RollupLevel { HOURLY, DAILY, R_LEVELS };
+
+class Rollup {
+public:
+    // ð Ŷ ֱ hourlyRetentionðġ  (׺   HOURLY  0̰ DAILY  )
+    explicit Rollup(int hourlyRetention = 24 * 7);
+
+    //   ȣ ׻  ̾  (buildTable/VideoTable   ״  )
+    void addCycle(long long t, const vector<Video>& videos);
+
+    long long rangeSum(RollupLevel lv, RollupMetric m, int row, long long t0, long long t1) const;// ð [t0, t1) Ŷ 
+    long long channelRangeSum(RollupLevel lv, RollupMetric m, const string& channelId, long long t0, long long t1) const;
+    void series(RollupLevel lv, RollupMetric m, int row, long long t0, long long t1, vector<pair<long long, long long>>& out) const;//(Ŷ  ð, )
+    void rangeSums(RollupLevel lv, RollupMetric m, long long t0, long long t1, vector<long long>& out, int threads = 0) const;//    
+
+    int channels() const { return (int)channelOf.size(); }
+    size_t memoryBytes() const;
+
+private:
+    //  Ŷ  ϳ. 0 ƴ ุ (, ) ŷ Ͱ BLOCKึ  FOR ŷ     
+    // ū  ϳ  ü Ʈ   ʵ ϸ base/   (PackedCounters  ġ)
+    struct Column {
+        static const int BLOCK = 1024;
+        int n = 0;
+        bool sparse = false;
+        PackedColumn rows, vals;//sparse: 0 ƴ  ȣ()  
+        vector<PackedColumn> blocks;//sparse ƴ 
+
+        void pack(const vector<long long>& v);
+        long long get(int i) const;//i >= n̸ 0 ( Ŷ  ڿ  )
+        void addTo(int lo, int hi, long long* acc) const;//acc[i-lo] += [i]
+        size_t bytes() const;
+    };
+    struct Bucket {
+        long long start;
+        Column video[R_METRICS];
+        Column channel[R_METRICS];
+    };
+    struct Level {
+        explicit Level(long long width) : width(width) {}
+        long long width;
+        deque<Bucket> closed;//ð 
+    };
+
+    Level level[R_LEVELS] = { Level(3600), Level(86400) };
+    int retention;
+    long long openStart = LLONG_MIN;//   ð Ŷ ( LLONG_MIN),  Ŷ   
+    vector<long long> openVideo[R_METRICS];
+    vector<long long> openChannel[R_METRICS];
+    vector<long long> last[R_METRICS];//  , ó   -1
+    vector<int> channelRow;//  -> ä ȣ
+    unordered_map<string, int> channelOf;
+
+    static long long floorDiv(long long a, long long b) { return a >= 0 ? a / b : -((-a + b - 1) / b); }
+    long long dayOf(long long t) const { return floorDiv(t, level[DAILY].width) * level[DAILY].width; }
+    void seal();
+    void fold(long long day);
+    void trim();
+    template <typename F> void visit(RollupLevel lv, long long t0, long long t1, F f) const;
+};
@@ -6,6 +6,7 @@ using namespace std;
 typedef int Score;//     ڷ 
 typedef Score* ScoPtr;// Score  
 
-Score CovScore(Score v) {
-	//  
+inline Score CovScore(Score v) {
+	//   .     ״   ( ϹǷ inline)
+	return v;
 }
@@ -0,0 +1,141 @@
+#include "Utility.h"
+#include "Skyline.h"
+#include "KeyCompress.h"
+
+long long parseTimestamp(const string& iso) {
+    int f[6] = { 0 };
+    const int len[6] = { 4, 2, 2, 2, 2, 2 };
+    size_t p = 0;
+    for (int i = 0; i < 6; i++) {
+        if (i > 0) { if (p >= iso.size()) return 0; p++; }// '-', 'T', ':'    ʰ ǳʶ
+        for (int j = 0; j < len[i]; j++, p++) {
+            if (p >= iso.size() || !isdigit((unsigned char)iso[p])) return 0;
+            f[i] = f[i] * 10 + (iso[p] - '0');
+        }
+    }
+    // ׷ ¥ -> 1970-01-01  
+    int y = f[0] - (f[1] <= 2), m = f[1];
+    long long era = (y >= 0 ? y : y - 399) / 400;
+    long long yoe = y - era * 400;
+    long long doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + f[2] - 1;
+    long long doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    long long days = era * 146097 + doe - 719468;
+    return days * 86400 + f[3] * 3600 + f[4] * 60 + f[5];
+}
+
+namespace {
+    // ະ    ( 񱳸 ึ  ޸𸮷  )
+    struct Columns {
+        vector<long long> c[SKY_DIMS];
+    };
+
+    struct Window {
+        vector<long long> c[SKY_DIMS];
+        vector<int> row;
+        void add(const Columns& src, int r) {
+            for (int d = 0; d < SKY_DIMS; d++) c[d].push_back(src.c[d][r]);
+            row.push_back(r);
+        }
+        // r ϴ    limit 
+        //   б    ϱ⸸ ؼ Ϸ ȭ  ְ 
+        int dominators(const Columns& src, int r, int limit) const {
+            long long p0 = src.c[0][r], p1 = src.c[1][r], p2 = src.c[2][r], p3 = src.c[3][r];
+            const long long* w0 = c[0].data(), * w1 = c[1].data(), * w2 = c[2].data(), * w3 = c[3].data();
+            int n = (int)row.size(), cnt = 0;
+            for (int s = 0; s < n && cnt < limit; s += 64) {
+                int e = min(n, s + 64);
+                for (int j = s; j < e; j++) {
+                    int ge = (w0[j] >= p0) & (w1[j] >= p1) & (w2[j] >= p2) & (w3[j] >= p3);
+                    int gt = (w0[j] > p0) | (w1[j] > p1) | (w2[j] > p2) | (w3[j] > p3);
+                    cnt += ge & gt;
+                }
+            }
+            return cnt;
+        }
+    };
+}
+
+static Columns loadColumns(const vector<Video>& videos) {
+    Columns cols;
+    for (int d = 0; d < SKY_DIMS; d++) cols.c[d].resize(videos.size());
+    for (size_t i = 0; i < videos.size(); i++) {
+        cols.c[SKY_VIEW][i] = max(0LL, videos[i].viewCount);
+        cols.c[SKY_LIKE][i] = max(0LL, videos[i].likeCount);
+        cols.c[SKY_COMMENT][i] = max(0LL, videos[i].commentCount);
+        cols.c[SKY_RECENT][i] = max(0LL, parseTimestamp(videos[i].publishedAt));
+    }
+    return cols;
+}
+
+// sort-first skyline: ϴ  ׻    Լ(ະ ִ񰪿   )  
+// ׷ 쿡      Ƿ ٽ   
+static vector<int> sortFirst(const Columns& cols, const vector<int>& rows, int k) {
+    int n = (int)rows.size();
+    double mx[SKY_DIMS];
+    for (int d = 0; d < SKY_DIMS; d++) {
+        mx[d] = 1;
+        for (int r : rows) mx[d] = max(mx[d], (double)cols.c[d][r]);
+    }
+    vector<Score> key(n);
+    for (int i = 0; i < n; i++) {
+        double f = 0;
+        for (int d = 0; d < SKY_DIMS; d++) f += cols.c[d][rows[i]] / mx[d];
+        key[i] = (Score)(f * 5e8);//0~4 -> int  ,   Ƿ   
+    }
+    vector<int> order;
+    argsortCompressed(key, order);
+
+    // ȭ Ű       ٽ ؼ "ڰ " 
+    auto lexGreater = [&](int a, int b) {
+        for (int d = 0; d < SKY_DIMS; d++)
+            if (cols.c[d][rows[a]] != cols.c[d][rows[b]]) return cols.c[d][rows[a]] > cols.c[d][rows[b]];
+        return rows[a] < rows[b];
+    };
+    for (int i = 0; i < n;) {
+        int j = i + 1;
+        while (j < n && key[order[j]] == key[order[i]]) j++;
+        if (j - i > 1) sort(order.begin() + i, order.begin() + j, lexGreater);
+        i = j;
+    }
+
+    // k-skyband: ڰ k ̻  ڵ   ϹǷ,   ڸ  
+    Window w;
+    for (int i = 0; i < n; i++) {
+        int r = rows[order[i]];
+        if (w.dominators(cols, r, k) < k) w.add(cols, r);
+    }
+    return w.row;
+}
+
+vector<int> skyband(const vector<Video>& videos, int k, int threads) {
+    if (k <= 0) throw out_of_range("k out of range");
+    int n = (int)videos.size();
+    Columns cols = loadColumns(videos);
+
+    //    skyband ķ ϰ,  տ    
+    // ü ڰ k ̸̸ ڱ  ȿ k ̸̹Ƿ   
+    if (threads <= 0) threads = max(1, (int)thread::hardware_concurrency());
+    threads = min(threads, max(1, n / 4096));
+    vector<vector<int>> part(threads);
+    auto work = [&](int t) {
+        int lo = (int)((long long)n * t / threads), hi = (int)((long long)n * (t + 1) / threads);
+        vector<int> rows(hi - lo);
+        for (int i = lo; i < hi; i++) rows[i - lo] = i;
+        part[t] = sortFirst(cols, rows, k);
+    };
+    if (threads == 1) work(0);
+    else {
+        vector<thread> pool;
+        for (int t = 0; t < threads; t++) pool.emplace_back(work, t);
+        for (thread& th : pool) th.join();
+    }
+    if (threads == 1) return part[0];
+
+    vector<int> merged;
+    for (auto& p : part) merged.insert(merged.end(), p.begin(), p.end());
+    return sortFirst(cols, merged, k);
+}
+
+vector<int> skyline(const vector<Video>& videos, int threads) {
+    return skyband(videos, 1, threads);
+}
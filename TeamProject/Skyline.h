@@ -0,0 +1,11 @@
+#pragma once
+#include "Utility.h"
+
+//  ǥε ٸ  и ʴ  (skyline / Pareto front)
+// ȸ, ƿ, , ֽż(publishedAt)  ࿡  ũų  ϳ ũ ""Ѵٰ 
+enum SkyDim { SKY_VIEW, SKY_LIKE, SKY_COMMENT, SKY_RECENT, SKY_DIMS };
+
+vector<int> skyline(const vector<Video>& videos, int threads = 0);//ƹԵ  ʴ  ȣ,  (ǥ  )
+vector<int> skyband(const vector<Video>& videos, int k, int threads = 0);//ϴ  k ̸  (k=1̸ skyline)
+
+long long parseTimestamp(const string& iso);//"YYYY-MM-DDTHH:MM:SS..." -> 1970 ,  ٸ 0
@@ -0,0 +1,78 @@
+#include "Utility.h"
+#include "StringSort.h"
+
+// depth ġ 8Ʈ 򿣵  . ڿ   0 (/ID \0 ڴ ٰ )
+//   ϸ 8ڸ    Ͱ Ƽ Ź ڿ  ʾƵ 
+static unsigned long long load8(const StrRef& r, int depth) {
+    unsigned long long v = 0;
+    for (int i = 0; i < 8; i++) {
+        int pos = depth + i;
+        unsigned char c = pos < r.len ? (unsigned char)r.s[pos] : 0;
+        v = (v << 8) | c;
+    }
+    return v;
+}
+
+static bool lessFrom(const StrRef& x, const StrRef& y, int depth) {
+    int lx = x.len - depth, ly = y.len - depth;
+    int c = memcmp(x.s + depth, y.s + depth, (size_t)min(lx, ly));
+    if (c != 0) return c < 0;
+    if (lx != ly) return lx < ly;
+    return x.id < y.id;
+}
+
+static void insertionFrom(vector<StrRef>& a, int lo, int hi, int depth) {
+    for (int i = lo + 1; i < hi; i++) {
+        StrRef t = a[i];
+        int j = i;
+        while (j > lo && lessFrom(t, a[j - 1], depth)) { a[j] = a[j - 1]; j--; }
+        a[j] = t;
+    }
+}
+
+// [lo, hi)  depth ձ   ڿ
+static void mkqs(vector<StrRef>& a, vector<unsigned long long>& cache, int lo, int hi, int depth) {
+    while (hi - lo > 16) {
+        for (int i = lo; i < hi; i++) cache[i] = load8(a[i], depth);
+
+        //   ߾Ӱ ǹ
+        unsigned long long x = cache[lo], y = cache[(lo + hi) / 2], z = cache[hi - 1];
+        unsigned long long piv = max(min(x, y), min(max(x, y), z));
+
+        // 3-way : [lo, lt) < piv, [lt, gt) == piv, [gt, hi) > piv
+        int lt = lo, i = lo, gt = hi;
+        while (i < gt) {
+            if (cache[i] < piv) { swap(a[i], a[lt]); swap(cache[i], cache[lt]); lt++; i++; }
+            else if (cache[i] > piv) { gt--; swap(a[i], a[gt]); swap(cache[i], cache[gt]); }
+            else i++;
+        }
+        mkqs(a, cache, lo, lt, depth);
+        mkqs(a, cache, gt, hi, depth);
+
+        if ((piv & 0xFF) == 0) {//8Ʈ ȿ ڿ  ->     ڿ
+            sort(a.begin() + lt, a.begin() + gt, [](const StrRef& p, const StrRef& q) { return p.id < q.id; });
+            return;
+        }
+        lo = lt; hi = gt; depth += 8;//   8Ʈ ( ͸ ݺ)
+    }
+    insertionFrom(a, lo, hi, depth);
+}
+
+void stringSort(vector<StrRef>& a) {
+    vector<unsigned long long> cache(a.size());
+    mkqs(a, cache, 0, (int)a.size(), 0);
+}
+
+vector<int> sortVideosBy(const vector<Video>& videos, VideoField f) {
+    int n = (int)videos.size();
+    vector<StrRef> a(n);
+    for (int i = 0; i < n; i++) {
+        const string& s = (f == VIDEO_ID) ? videos[i].videoId
+            : (f == TITLE) ? videos[i].title : videos[i].channelTitle;
+        a[i] = StrRef{ s.data(), (int)s.size(), i };
+    }
+    stringSort(a);
+    vector<int> order(n);
+    for (int i = 0; i < n; i++) order[i] = a[i].id;
+    return order;
+}
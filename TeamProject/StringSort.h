@@ -0,0 +1,15 @@
+#pragma once
+#include "Utility.h"
+
+// ڿ   (multikey quicksort). BasicSort Score ٷǷ /äθ/videoId Ŀ  
+// ڿ  ʰ Video  string Ű StrRef ű
+struct StrRef {
+    const char* s;
+    int len;
+    int id;//    ˱  ȣ,  ڿ id 
+};
+
+enum VideoField { VIDEO_ID, TITLE, CHANNEL_TITLE };
+
+void stringSort(vector<StrRef>& a);//Ʈ  
+vector<int> sortVideosBy(const vector<Video>& videos, VideoField f);//ĵ   ȣ
@@ -0,0 +1,160 @@
+#include "Utility.h"
+#include "TagPairs.h"
+
+SpaceSaving::SpaceSaving(int capacity) : cap(capacity), n(0) {
+    if (capacity <= 0) throw invalid_argument("capacity must be positive");
+    heap.reserve(capacity);
+    pos.reserve(capacity * 2);
+}
+
+void SpaceSaving::swapAt(int i, int j) {
+    swap(heap[i], heap[j]);
+    pos[heap[i].key] = i;
+    pos[heap[j].key] = j;
+}
+
+void SpaceSaving::siftUp(int i) {
+    while (i > 0) {
+        int p = (i - 1) / 2;
+        if (heap[p].count <= heap[i].count) break;
+        swapAt(i, p);
+        i = p;
+    }
+}
+
+void SpaceSaving::siftDown(int i) {
+    int sz = (int)heap.size();
+    while (true) {
+        int l = i * 2 + 1, r = l + 1, best = i;
+        if (l < sz && heap[l].count < heap[best].count) best = l;
+        if (r < sz && heap[r].count < heap[best].count) best = r;
+        if (best == i) break;
+        swapAt(i, best);
+        i = best;
+    }
+}
+
+void SpaceSaving::add(unsigned long long key, long long w) {
+    n += w;
+    auto it = pos.find(key);
+    if (it != pos.end()) {
+        heap[it->second].count += w;
+        siftDown(it->second);
+        return;
+    }
+    if ((int)heap.size() < cap) {
+        heap.push_back(Counter{ key, w, 0 });
+        pos[key] = (int)heap.size() - 1;
+        siftUp((int)heap.size() - 1);
+        return;
+    }
+    //   ī͸  Ű Ѱ,  ŭ  
+    Counter& m = heap[0];
+    pos.erase(m.key);
+    m.error = m.count;
+    m.count += w;
+    m.key = key;
+    pos[key] = 0;
+    siftDown(0);
+}
+
+long long SpaceSaving::minCount() const {
+    return (int)heap.size() < cap ? 0 : heap[0].count;
+}
+
+long long SpaceSaving::total() const { return n; }
+
+size_t SpaceSaving::memoryBytes() const {
+    return heap.capacity() * sizeof(Counter) + pos.size() * (sizeof(unsigned long long) + sizeof(int) + 2 * sizeof(void*));
+}
+
+void SpaceSaving::merge(const SpaceSaving& other) {
+    // ʿ ִ Ű ٸ ʿ ִ minCountŭ   Ƿ ׸ŭ ؼ  
+    long long m1 = minCount(), m2 = other.minCount();
+    unordered_map<unsigned long long, Counter> all;
+    all.reserve(heap.size() + other.heap.size());
+    for (const Counter& c : heap) all[c.key] = Counter{ c.key, c.count + m2, c.error + m2 };
+    for (const Counter& c : other.heap) {
+        auto it = all.find(c.key);
+        if (it != all.end()) {
+            it->second.count += c.count - m2;
+            it->second.error += c.error - m2;
+        }
+        else all[c.key] = Counter{ c.key, c.count + m1, c.error + m1 };
+    }
+    vector<Counter> v;
+    v.reserve(all.size());
+    for (auto& e : all) v.push_back(e.second);
+    if ((int)v.size() > cap) {
+        nth_element(v.begin(), v.begin() + cap, v.end(), [](const Counter& a, const Counter& b) { return a.count > b.count; });
+        v.resize(cap);
+    }
+    n += other.n;
+    heap = move(v);
+    pos.clear();
+    for (int i = 0; i < (int)heap.size(); i++) pos[heap[i].key] = i;
+    for (int i = (int)heap.size() / 2 - 1; i >= 0; i--) siftDown(i);
+}
+
+vector<SpaceSaving::Counter> SpaceSaving::top(int k) const {
+    vector<Counter> v = heap;
+    int keep = min(k, (int)v.size());
+    partial_sort(v.begin(), v.begin() + keep, v.end(), [](const Counter& a, const Counter& b) {
+        return a.count != b.count ? a.count > b.count : a.key < b.key;
+    });
+    v.resize(keep);
+    return v;
+}
+
+TagPairResult topTagPairs(const vector<Video>& videos, int k, int capacity, int threads) {
+    int n = (int)videos.size();
+
+    // 1) ±׸  ٲ  ( Ű 64Ʈ ϳ  ),   ߺ ±״ 
+    unordered_map<string, int> idOf;
+    vector<string> names;
+    vector<vector<int>> tagIds(n);
+    for (int i = 0; i < n; i++) {
+        for (const string& raw : videos[i].tags) {
+            string t = normalizeTag(raw);//"Music" "music"  ±׷ (MinHashLSH  Ģ)
+            auto it = idOf.find(t);
+            int id;
+            if (it == idOf.end()) { id = (int)names.size(); idOf[t] = id; names.push_back(t); }
+            else id = it->second;
+            tagIds[i].push_back(id);
+        }
+        sort(tagIds[i].begin(), tagIds[i].end());
+        tagIds[i].erase(unique(tagIds[i].begin(), tagIds[i].end()), tagIds[i].end());
+    }
+
+    // 2)     帶 ڱ ࿡  ( )
+    if (threads <= 0) threads = max(1, (int)thread::hardware_concurrency());
+    threads = max(1, min(threads, n / 256));
+    vector<SpaceSaving> shard(threads, SpaceSaving(capacity));
+    vector<thread> pool;
+    for (int t = 0; t < threads; t++) {
+        int lo = (int)((long long)n * t / threads), hi = (int)((long long)n * (t + 1) / threads);
+        pool.emplace_back([&, t, lo, hi]() {
+            for (int i = lo; i < hi; i++) {
+                const vector<int>& g = tagIds[i];
+                for (size_t x = 0; x < g.size(); x++)
+                    for (size_t y = x + 1; y < g.size(); y++)
+                        shard[t].add(((unsigned long long)g[x] << 32) | (unsigned)g[y]);
+            }
+        });
+    }
+    for (thread& th : pool) th.join();
+
+    TagPairResult r;
+    r.memoryBytes = 0;
+    for (const SpaceSaving& s : shard) r.memoryBytes += s.memoryBytes();
+    for (int t = 1; t < threads; t++) shard[0].merge(shard[t]);
+
+    r.totalPairs = shard[0].total();
+    r.maxError = shard[0].minCount();
+    for (const SpaceSaving::Counter& c : shard[0].top(k)) {
+        int a = (int)(c.key >> 32), b = (int)(c.key & 0xFFFFFFFFu);
+        if (names[b] < names[a]) swap(a, b);
+        r.top.push_back(TagPairCount{ names[a], names[b], c.count, c.error });
+    }
+    return r;
+}
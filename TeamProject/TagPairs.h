@@ -0,0 +1,48 @@
+#pragma once
+#include "Utility.h"
+
+// Space-Saving : ִ capacity (Ű, , )  Ʈ   Ű ã
+//   [count - error, count] ȿ ְ, error ü  / capacity  
+class SpaceSaving {
+public:
+    struct Counter {
+        unsigned long long key;
+        long long count;
+        long long error;
+    };
+
+    explicit SpaceSaving(int capacity);
+
+    void add(unsigned long long key, long long w = 1);
+    void merge(const SpaceSaving& other);//ٸ   ħ (/ ϰ capacity )
+    vector<Counter> top(int k) const;//count 
+    long long minCount() const;//  á   Ű   ִ ִ 
+    long long total() const;
+    size_t memoryBytes() const;
+
+private:
+    int cap;
+    long long n;
+    vector<Counter> heap;//count  ּ 
+    unordered_map<unsigned long long, int> pos;//Ű ->  ġ
+
+    void siftDown(int i);
+    void siftUp(int i);
+    void swapAt(int i, int j);
+};
+
+struct TagPairCount {
+    string a, b;//a < b, normalizeTag() 
+    long long count;//  (  )
+    long long error;//  count - error ̻
+};
+
+struct TagPairResult {
+    vector<TagPairCount> top;
+    long long totalPairs;//   
+    long long maxError;// ̵   
+    size_t memoryBytes;//   ޸ 
+};
+
+// 󸶴 ±   () Space-Saving   ħ
+TagPairResult topTagPairs(const vector<Video>& videos, int k, int capacity = 1 << 16, int threads = 0);
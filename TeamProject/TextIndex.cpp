@@ -0,0 +1,256 @@
+#include "Utility.h"
+#include "TextIndex.h"
+
+static const float K1 = 1.2f;
+static const float B = 0.75f;
+
+void tokenize(const string& text, vector<string>& out) {
+    string cur;
+    for (unsigned char c : text) {
+        bool word = (c >= 0x80) || isalnum(c);//0x80 ̻ UTF-8 ѱ  Ϻζ ū 
+        if (word) cur += (c < 0x80) ? (char)tolower(c) : (char)c;
+        else if (!cur.empty()) { out.push_back(cur); cur.clear(); }
+    }
+    if (!cur.empty()) out.push_back(cur);
+}
+
+static void putVarint(vector<unsigned char>& d, unsigned v) {
+    while (v >= 0x80) { d.push_back((unsigned char)(v | 0x80)); v >>= 7; }
+    d.push_back((unsigned char)v);
+}
+
+static unsigned getVarint(const unsigned char*& p) {
+    unsigned v = 0;
+    int sh = 0;
+    while (*p & 0x80) { v |= (unsigned)(*p++ & 0x7F) << sh; sh += 7; }
+    v |= (unsigned)(*p++) << sh;
+    return v;
+}
+
+float TextIndex::impact(int tf, int doc, float idf) const {
+    float norm = K1 * (1 - B + B * (float)(docLen[doc] / avgLen));
+    return idf * (tf * (K1 + 1)) / (tf + norm);
+}
+
+void TextIndex::build(const vector<Video>& videos) {
+    int n = (int)videos.size();
+    dict.clear(); terms.clear(); blocks.clear(); data.clear();
+    docLen.assign(n, 0);
+    prior.assign(n, 0);
+
+    // 1)  ū    ( ȣ  )
+    vector<vector<pair<int, int>>> postings;
+    vector<string> toks;
+    unordered_map<int, int> tf;
+    long long totalLen = 0;
+    for (int d = 0; d < n; d++) {
+        toks.clear();
+        tokenize(videos[d].title, toks);
+        tokenize(videos[d].description, toks);
+        docLen[d] = (int)toks.size();
+        totalLen += docLen[d];
+        tf.clear();
+        for (const string& w : toks) {
+            auto it = dict.find(w);
+            int id;
+            if (it == dict.end()) { id = (int)postings.size(); dict[w] = id; postings.emplace_back(); }
+            else id = it->second;
+            tf[id]++;
+        }
+        for (auto& e : tf) postings[e.first].push_back(make_pair(d, e.second));
+    }
+    avgLen = n ? max(1.0, (double)totalLen / n) : 1.0;
+
+    // 2)  :  score 0  ִ  0~1
+    Score mx = 0;
+    for (const Video& v : videos) mx = max(mx, v.score);
+    for (int d = 0; d < n; d++) prior[d] = mx > 0 ? (float)max(0, videos[d].score) / mx : 0.0f;
+    priorBlockMax.assign((n + BLOCK - 1) / BLOCK, 0.0f);
+    for (int d = 0; d < n; d++) priorBlockMax[d / BLOCK] = max(priorBlockMax[d / BLOCK], prior[d]);
+
+    // 3)    varint  +  ִ 
+    terms.resize(postings.size());
+    for (size_t t = 0; t < postings.size(); t++) {
+        vector<pair<int, int>>& pl = postings[t];
+        Term& tm = terms[t];
+        tm.df = (int)pl.size();
+        tm.idf = (float)log(1.0 + (n - tm.df + 0.5) / (tm.df + 0.5));
+        tm.firstBlock = (int)blocks.size();
+        tm.maxImpact = 0;
+        int prev = -1;
+        for (size_t s = 0; s < pl.size(); s += BLOCK) {
+            Block bl;
+            bl.offset = (int)data.size();
+            bl.count = (int)min((size_t)BLOCK, pl.size() - s);
+            bl.maxImpact = 0;
+            for (int j = 0; j < bl.count; j++) {
+                int d = pl[s + j].first, f = pl[s + j].second;
+                putVarint(data, (unsigned)(d - prev));
+                putVarint(data, (unsigned)f);
+                prev = d;
+                bl.maxImpact = max(bl.maxImpact, impact(f, d, tm.idf));
+            }
+            bl.lastDoc = prev;
+            tm.maxImpact = max(tm.maxImpact, bl.maxImpact);
+            blocks.push_back(bl);
+        }
+        tm.blocks = (int)blocks.size() - tm.firstBlock;
+        vector<pair<int, int>>().swap(pl);//   ٷ 
+    }
+}
+
+void TextIndex::decodeBlock(int b, int baseDoc, int* docs, int* tfs) const {
+    const unsigned char* p = data.data() + blocks[b].offset;
+    int d = baseDoc;
+    for (int j = 0; j < blocks[b].count; j++) {
+        d += (int)getVarint(p);
+        docs[j] = d;
+        tfs[j] = (int)getVarint(p);
+    }
+}
+
+int TextIndex::termId(const string& token) const {
+    auto it = dict.find(token);
+    return it == dict.end() ? -1 : it->second;
+}
+
+size_t TextIndex::memoryBytes() const {
+    size_t s = data.size() + blocks.size() * sizeof(Block) + terms.size() * sizeof(Term);
+    s += docLen.size() * sizeof(int) + (prior.size() + priorBlockMax.size()) * sizeof(float);
+    for (auto& e : dict) s += e.first.size() + sizeof(int);
+    return s;
+}
+
+//    󰡴 Ŀ.   ϳ Ǯ  ְ,  ǳʶٱ lastDoc 
+struct TextIndex::Cursor {
+    static const int END = INT_MAX;
+    const TextIndex* ix;
+    int first, bEnd;
+    int b;//Ǯ  
+    int sb;//block-max  (Ǯ ʰ) ű 
+    int pos;
+    int doc;
+    float idf, ub;
+    int docs[BLOCK], tfs[BLOCK];
+
+    void init(const TextIndex* index, int t) {
+        ix = index;
+        const Term& tm = ix->terms[t];
+        first = tm.firstBlock; bEnd = first + tm.blocks;
+        idf = tm.idf; ub = tm.maxImpact;
+        b = sb = first;
+        load();
+    }
+    void load() {
+        if (b >= bEnd) { doc = END; return; }
+        int base = (b == first) ? -1 : ix->blocks[b - 1].lastDoc;
+        ix->decodeBlock(b, base, docs, tfs);
+        pos = 0;
+        doc = docs[0];
+        sb = max(sb, b);
+    }
+    void nextGEQ(int target) {
+        if (doc >= target) return;
+        int nb = b;
+        while (nb < bEnd && ix->blocks[nb].lastDoc < target) nb++;
+        if (nb != b) { b = nb; load(); if (doc == END) return; }
+        while (docs[pos] < target) pos++;//lastDoc >= target ̹Ƿ  ȿ ݵ 
+        doc = docs[pos];
+    }
+    float shallowMax(int target) {//target  ִ  ִ ,  0
+        while (sb < bEnd && ix->blocks[sb].lastDoc < target) sb++;
+        return sb < bEnd ? ix->blocks[sb].maxImpact : 0.0f;
+    }
+    int shallowEnd() const { return sb < bEnd ? ix->blocks[sb].lastDoc : END - 1; }
+    float score() const { return ix->impact(tfs[pos], doc, idf); }
+};
+
+double TextIndex::scoreOf(const vector<int>& termIds, int doc, double alpha) const {
+    double s = alpha * prior[doc];
+    bool hit = false;
+    for (int t : termIds) {
+        Cursor c;
+        c.init(this, t);
+        c.nextGEQ(doc);
+        if (c.doc == doc) { s += c.score(); hit = true; }
+    }
+    return hit ? s : 0.0;
+}
+
+vector<pair<int, double>> TextIndex::search(const string& query, int k, double alpha) const {
+    vector<pair<int, double>> res;
+    if (k <= 0) return res;
+
+    vector<string> toks;
+    tokenize(query, toks);
+    vector<int> ids;
+    for (const string& w : toks) {
+        int t = termId(w);
+        if (t >= 0 && find(ids.begin(), ids.end(), t) == ids.end()) ids.push_back(t);
+    }
+    int m = (int)ids.size();
+    if (m == 0) return res;
+
+    vector<Cursor> cur(m);
+    for (int i = 0; i < m; i++) cur[i].init(this, ids[i]);
+    vector<Cursor*> c(m);
+    for (int i = 0; i < m; i++) c[i] = &cur[i];
+
+    float priorMax = 0;
+    for (float x : priorBlockMax) priorMax = max(priorMax, x);
+
+    // (, ) ּ , theta = k°  ( k  á -1)
+    priority_queue<pair<double, int>, vector<pair<double, int>>, greater<pair<double, int>>> top;
+    double theta = -1;
+    auto byDoc = [](const Cursor* x, const Cursor* y) { return x->doc < y->doc; };
+
+    while (true) {
+        sort(c.begin(), c.end(), byDoc);
+        if (c[0]->doc == Cursor::END) break;
+
+        // ǹ ã: տ  ؼ theta ó Ѵ  (WAND)
+        double acc = alpha * priorMax;
+        int p = -1;
+        for (int i = 0; i < m && c[i]->doc != Cursor::END; i++) {
+            acc += c[i]->ub;
+            if (acc > theta) { p = i; break; }
+        }
+        if (p < 0) break;
+        int pivot = c[p]->doc;
+        while (p + 1 < m && c[p + 1]->doc == pivot) p++;
+
+        //       Ÿ (Block-Max WAND)
+        double bound = alpha * priorBlockMax[pivot / BLOCK];
+        for (int i = 0; i <= p; i++) bound += c[i]->shallowMax(pivot);
+
+        if (bound > theta) {
+            if (c[0]->doc == pivot) {
+                double s = alpha * prior[pivot];
+                for (int i = 0; i <= p; i++) s += c[i]->score();
+                if ((int)top.size() < k) top.push(make_pair(s, pivot));
+                else if (s > top.top().first) { top.pop(); top.push(make_pair(s, pivot)); }
+                if ((int)top.size() == k) theta = top.top().first;
+                for (int i = 0; i <= p; i++) c[i]->nextGEQ(pivot + 1);
+            }
+            else {
+                // ǹ ó Ŀ    ū  ǹ 
+                int best = 0;
+                for (int i = 1; i < p && c[i]->doc < pivot; i++) if (c[i]->ub > c[best]->ub) best = i;
+                c[best]->nextGEQ(pivot);
+            }
+        }
+        else {
+            //  ϵδ theta   ->        ǳʶ
+            long long next = (long long)(pivot / BLOCK + 1) * BLOCK;
+            for (int i = 0; i <= p; i++) next = min(next, (long long)c[i]->shallowEnd() + 1);
+            if (p + 1 < m) next = min(next, (long long)c[p + 1]->doc);
+            int best = 0;
+            for (int i = 1; i <= p; i++) if (c[i]->ub > c[best]->ub) best = i;
+            c[best]->nextGEQ((int)next);
+        }
+    }
+
+    while (!top.empty()) { res.push_back(make_pair(top.top().second, top.top().first)); top.pop(); }
+    reverse(res.begin(), res.end());
+    return res;
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include "Utility.h"
+
+// /  ˻ . ˻  BM25 ؽƮ   score   ű
+//  128   varint ϰ, ϸ ִ (block-max) ؼ
+// Block-Max WAND top-k    /   ʰ ǳʶ
+class TextIndex {
+public:
+    static const int BLOCK = 128;
+
+    void build(const vector<Video>& videos);// ȣ   ȣ
+    vector<pair<int, double>> search(const string& query, int k, double alpha = 1.0) const;//(, )  
+    double scoreOf(const vector<int>& termIds, int doc, double alpha) const;//     (/׿)
+    int termId(const string& token) const;//  -1
+    size_t memoryBytes() const;
+
+private:
+    struct Block {
+        int lastDoc;//   ȣ, ̰͸   ǳʶ
+        int offset;//data  ġ
+        int count;
+        float maxImpact;// ȿ  ū BM25 
+    };
+    struct Term {
+        int df;
+        int firstBlock;
+        int blocks;
+        float idf;
+        float maxImpact;//ü   ִ BM25 
+    };
+    struct Cursor;
+
+    unordered_map<string, int> dict;
+    vector<Term> terms;
+    vector<Block> blocks;
+    vector<unsigned char> data;//Ϻ ( , tf) varint ̾ 
+    vector<int> docLen;
+    double avgLen = 0;
+    vector<float> prior;//   (score / ִ score, 0~1)
+    vector<float> priorBlockMax;// ȣ BLOCK  prior ִ
+
+    float impact(int tf, int doc, float idf) const;
+    void decodeBlock(int b, int baseDoc, int* docs, int* tfs) const;
+};
+
+void tokenize(const string& text, vector<string>& out);//ASCII ҹڷ, //ѱ(UTF-8) Ʈ ̾  ū
@@ -21,3 +21,19 @@ int partition_d(vector<Score>& p, int left, int right) {
     }
     return i;
 }
+int bitWidth(unsigned long long v) {
+    int w = 0;//ݾ ߶󰡸  ִ 7 
+    if (v >> 32) { v >>= 32; w += 32; }
+    if (v >> 16) { v >>= 16; w += 16; }
+    if (v >> 8) { v >>= 8; w += 8; }
+    if (v >> 4) { v >>= 4; w += 4; }
+    if (v >> 2) { v >>= 2; w += 2; }
+    if (v >> 1) { v >>= 1; w += 1; }
+    return w + (int)v;
+}
+
+string normalizeTag(const string& tag) {
+    string low = tag;
+    for (char& c : low) c = (char)tolower((unsigned char)c);
+    return low;
+}
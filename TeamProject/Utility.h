@@ -44,3 +44,5 @@ typedef struct YouTubeVideoInfo {
 int partition_d(vector<Score>& p, int left, int right);//    Ҷ  Ƽ Լ ߺǼ ̰ 
 inline void swapValueheap(Heap& det, vector<Score>& src, int i);//  Լ   
 void copyValue(const Heap heap, int i, vector<Score>& q, int j);//  ص
+int bitWidth(unsigned long long v);//v ǥϴ  ʿ Ʈ  (0̸ 0),  /Ű ࿡ 
+string normalizeTag(const string& tag);//± 񱳿  (ASCII ҹ), MinHashLSH/TagPairs  Ģ 
@@ -0,0 +1,59 @@
+#include "Utility.h"
+#include "VideoId.h"
+
+// ASCII : '-' < '0'..'9' < 'A'..'Z' < '_' < 'a'..'z'
+static const char RANK_CHARS[65] = "-0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ_abcdefghijklmnopqrstuvwxyz";
+//  ڿ   ִ 16 (base64 ȣ 4 ),  ASCII 
+static const char LAST_CHARS[17] = "048AEIMQUYcgkosw";
+
+struct IdTables {
+    signed char rank[256];
+    signed char lastRank[256];
+    IdTables() {
+        memset(rank, -1, sizeof(rank));
+        memset(lastRank, -1, sizeof(lastRank));
+        for (int i = 0; i < 64; i++) rank[(unsigned char)RANK_CHARS[i]] = (signed char)i;
+        for (int i = 0; i < 16; i++) lastRank[(unsigned char)LAST_CHARS[i]] = (signed char)i;
+    }
+};
+static const IdTables tables;
+
+bool tryPackVideoId(const string& s, PackedId& out) {
+    if (s.size() != 11) return false;
+    const unsigned char* c = (const unsigned char*)s.data();
+    PackedId v = 0;
+    int bad = 0;
+    // б  ǥ  װ, ߸ ڴ    Ȯ
+    for (int i = 0; i < 10; i++) {
+        int r = tables.rank[c[i]];
+        bad |= r;
+        v = (v << 6) | (PackedId)(r & 63);
+    }
+    int last = tables.lastRank[c[10]];
+    bad |= last;
+    v = (v << 4) | (PackedId)(last & 15);
+    if (bad < 0) return false;
+    out = v;
+    return true;
+}
+
+PackedId packVideoId(const string& s) {
+    PackedId v;
+    if (!tryPackVideoId(s, v)) throw invalid_argument("not a YouTube video id");
+    return v;
+}
+
+void unpackVideoId(PackedId id, char out[11]) {
+    out[10] = LAST_CHARS[id & 15];
+    id >>= 4;
+    for (int i = 9; i >= 0; i--) {
+        out[i] = RANK_CHARS[id & 63];
+        id >>= 6;
+    }
+}
+
+string unpackVideoId(PackedId id) {
+    char buf[11];
+    unpackVideoId(id, buf);
+    return string(buf, 11);
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include "Utility.h"
+
+// Ʃ videoId(base64url 11) 64Ʈ  ϳ  
+//  10ڴ 6Ʈ,  ڴ 16̶ 4Ʈ -> Ȯ 64Ʈ
+// ڸ ASCII  ȣ Űܼ     ڿ 񱳿 
+typedef unsigned long long PackedId;
+
+bool tryPackVideoId(const string& s, PackedId& out);//ùٸ 11 ID ƴϸ false
+PackedId packVideoId(const string& s);//ùٸ  invalid_argument
+string unpackVideoId(PackedId id);
+void unpackVideoId(PackedId id, char out[11]);//ڿ Ҵ  ۿ 
+
+struct PackedIdHash {//unordered_map, Ʒ Ʈ  ̺   
+    size_t operator()(PackedId x) const {
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        return (size_t)x;
+    }
+};
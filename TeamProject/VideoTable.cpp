@@ -0,0 +1,182 @@
+#include "Utility.h"
+#include "VideoTable.h"
+
+int VideoTable::size() const { return (int)score.size(); }
+
+void VideoTable::touch(Column c) { version[c]++; }
+
+const ColumnStats& VideoTable::columnStats(Column c) const {
+    if (cachedVersion[c] != version[c]) {
+        switch (c) {
+        case VIEW: cached[c] = computeStats(viewCount.data(), size()); break;
+        case LIKE: cached[c] = computeStats(likeCount.data(), size()); break;
+        case COMMENT: cached[c] = computeStats(commentCount.data(), size()); break;
+        default: cached[c] = computeStats(score); break;
+        }
+        cachedVersion[c] = version[c];
+    }
+    return cached[c];
+}
+
+void VideoTable::rescanZone(int z) const {
+    int lo = z * ZONE, hi = min(size(), lo + ZONE);
+    Score mn = score[lo], mx = score[lo];
+    for (int i = lo + 1; i < hi; i++) { mn = min(mn, score[i]); mx = max(mx, score[i]); }
+    zmin[z] = mn;
+    zmax[z] = mx;
+}
+
+void VideoTable::refreshZones() const {
+    if (zoneVersion == version[SCORE]) return;
+    int nz = zones();
+    zmin.resize(nz);
+    zmax.resize(nz);
+    for (int z = 0; z < nz; z++) rescanZone(z);
+    zoneVersion = version[SCORE];
+}
+
+int VideoTable::zones() const { return (size() + ZONE - 1) / ZONE; }
+Score VideoTable::zoneMin(int z) const { refreshZones(); return zmin[z]; }
+Score VideoTable::zoneMax(int z) const { refreshZones(); return zmax[z]; }
+
+// score[i] ٲٸ鼭 zone map  (i == size() ڿ ߰)
+// о  ٷ ݿϰ, ĭ ּ/ִ뿴      ĭ ٽ 
+void VideoTable::setScore(int i, Score s) {
+    bool synced = zoneVersion == version[SCORE];
+    int z = i / ZONE;
+    if (i == size()) {
+        score.push_back(s);
+        if (synced) {
+            if (i % ZONE == 0) { zmin.push_back(s); zmax.push_back(s); }
+            else { zmin[z] = min(zmin[z], s); zmax[z] = max(zmax[z], s); }
+        }
+    }
+    else {
+        Score old = score[i];
+        score[i] = s;
+        if (synced) {
+            if ((old == zmax[z] && s < old) || (old == zmin[z] && s > old)) rescanZone(z);
+            else { zmin[z] = min(zmin[z], s); zmax[z] = max(zmax[z], s); }
+        }
+    }
+    touch(SCORE);
+    if (synced) zoneVersion = version[SCORE];
+}
+
+static int intern(unordered_map<string, int>& idOf, vector<string>& names, const string& s) {
+    auto it = idOf.emplace(s, (int)names.size());
+    if (it.second) names.push_back(s);
+    return it.first->second;
+}
+
+int VideoTable::upsert(const Video& v, int srcRow) {
+    PackedId key = 0;
+    bool valid = tryPackVideoId(v.videoId, key);
+    if (valid) {
+        auto it = rowOf.find(key);
+        if (it != rowOf.end()) {
+            int i = it->second;
+            viewCount[i] = v.viewCount;
+            likeCount[i] = v.likeCount;
+            commentCount[i] = v.commentCount;
+            row[i] = srcRow;
+            int cat = intern(categoryOf, categoryName, v.categoryId), ch = intern(channelOf, channelName, v.channelId);
+            if (cat != category[i] || ch != channel[i]) { category[i] = cat; channel[i] = ch; layout++; }
+            for (int c = 0; c < SCORE; c++) touch((Column)c);
+            setScore(i, v.score);
+            return i;
+        }
+    }
+    int i = size();
+    viewCount.push_back(v.viewCount);
+    likeCount.push_back(v.likeCount);
+    commentCount.push_back(v.commentCount);
+    row.push_back(srcRow);
+    id.push_back(valid ? key : 0);
+    idValid.push_back(valid ? 1 : 0);
+    if (valid) rowOf[key] = i;//ID ̻  ߰ ϵ ο  
+    category.push_back(intern(categoryOf, categoryName, v.categoryId));
+    channel.push_back(intern(channelOf, channelName, v.channelId));
+    layout++;
+    for (int c = 0; c < SCORE; c++) touch((Column)c);
+    setScore(i, v.score);
+    return i;
+}
+
+int VideoTable::find(PackedId key) const {
+    auto it = rowOf.find(key);
+    return it == rowOf.end() ? -1 : it->second;
+}
+
+template <typename T>
+static void permute(vector<T>& a, const vector<int>& order) {
+    vector<T> b(a.size());
+    for (size_t i = 0; i < order.size(); i++) b[i] = a[order[i]];
+    a.swap(b);
+}
+
+//    ä, īװ    -> (īװ, ä,  ) 
+static void countingPass(const vector<int>& key, int keys, vector<int>& order) {
+    vector<int> start(keys + 1, 0);
+    for (int r : order) start[key[r] + 1]++;
+    for (int k = 0; k < keys; k++) start[k + 1] += start[k];
+    vector<int> out(order.size());
+    for (int r : order) out[start[key[r]]++] = r;
+    order.swap(out);
+}
+
+vector<int> VideoTable::cluster() {
+    int n = size();
+    vector<int> order(n);
+    for (int i = 0; i < n; i++) order[i] = i;
+    countingPass(channel, (int)channelName.size(), order);
+    countingPass(category, (int)categoryName.size(), order);
+
+    permute(viewCount, order);
+    permute(likeCount, order);
+    permute(commentCount, order);
+    permute(score, order);
+    permute(row, order);
+    permute(id, order);
+    permute(idValid, order);
+    permute(category, order);
+    permute(channel, order);
+    vector<int> remap(n);
+    for (int i = 0; i < n; i++) remap[order[i]] = i;
+    for (auto& e : rowOf) e.second = remap[e.second];
+
+    categoryRanges.clear();
+    channelRanges.clear();
+    for (int i = 0; i < n;) {
+        int j = i;
+        while (j < n && category[j] == category[i]) {
+            int k = j;
+            while (k < n && category[k] == category[i] && channel[k] == channel[j]) k++;
+            channelRanges.push_back(Range{ channel[j], j, k });
+            j = k;
+        }
+        categoryRanges.push_back(Range{ category[i], i, j });
+        i = j;
+    }
+
+    for (int c = 0; c < COLUMNS; c++) touch((Column)c);//zone map   ȸ   ġ ٽ 
+    clusterLayout = layout;
+    return remap;
+}
+
+VideoTable buildTable(const vector<Video>& videos) {
+    VideoTable t;
+    int n = (int)videos.size();
+    t.viewCount.reserve(n);
+    t.likeCount.reserve(n);
+    t.commentCount.reserve(n);
+    t.score.reserve(n);
+    t.row.reserve(n);
+    t.id.reserve(n);
+    t.idValid.reserve(n);
+    t.category.reserve(n);
+    t.channel.reserve(n);
+    t.rowOf.reserve(n);
+    for (int i = 0; i < n; i++) t.upsert(videos[i], i);// ID      
+    return t;
+}
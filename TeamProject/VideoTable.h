@@ -0,0 +1,59 @@
+#pragma once
+#include "Utility.h"
+#include "ColumnStats.h"
+#include "VideoId.h"
+
+// Video 迭 (column)  Ǯ 
+// /ȸ ȴ  Video ü ü(ڿ )  ٴ ʵ    
+struct VideoTable {
+    enum Column { VIEW, LIKE, COMMENT, SCORE, COLUMNS };
+    static const int ZONE = 4096;//zone map  ĭ   
+
+    vector<long long> viewCount;
+    vector<long long> likeCount;
+    vector<long long> commentCount;
+    vector<Score> score;
+    vector<int> row;// vector<Video> ε, ڿ   ãư
+    vector<PackedId> id;//videoId   , ùٸ ID ƴϸ 0 ( "----------0" 0̹Ƿ ȿ δ idValid )
+    vector<char> idValid;//videoId ùٸ 11ڸ ̾ 1
+    unordered_map<PackedId, int, PackedIdHash> rowOf;//id ->  ̺  (upsert )
+    vector<int> category;//categoryId 0 ű ȣ
+    vector<int> channel;//channelId 0 ű ȣ
+    vector<string> categoryName, channelName;//ȣ ->  ID
+    unordered_map<string, int> categoryOf, channelOf;
+
+    struct Range { int group, lo, hi; };// [lo, hi)   ׷
+    vector<Range> categoryRanges;//cluster() ڿ ȿ, īװ ȣ 
+    vector<Range> channelRanges;//cluster() ڿ ȿ, (īװ, ä) .  īװ ģ ä   
+
+    unsigned version[COLUMNS] = { 1, 1, 1, 1 };// ĥ  touch() ø,  ĳð   ȿ Ǵ
+
+    int size() const;
+    void touch(Column c);
+    const ColumnStats& columnStats(Column c) const;// ٲ ʾ ٽ  ʰ   踦 
+    int upsert(const Video& v, int srcRow);// videoId    ,  ڿ ߰.  ȣ ȯ
+    int find(PackedId key) const;// -1
+
+    //  (īװ, ä,  )  ġϰ ׷  . ȯ   ->  
+    //   ٰų ׷ ٲ clustered() false ǰ  ٽ cluster()    
+    vector<int> cluster();
+    bool clustered() const { return clusterLayout == layout; }
+
+    // score  zone map: ZONEึ ּ/ִ. upsert ٷ ġ, score  ģ  touch(SCORE)ϸ  ȸ  ٽ 
+    int zones() const;
+    Score zoneMin(int z) const;
+    Score zoneMax(int z) const;
+
+private:
+    mutable ColumnStats cached[COLUMNS];
+    mutable unsigned cachedVersion[COLUMNS] = { 0, 0, 0, 0 };
+    mutable vector<Score> zmin, zmax;
+    mutable unsigned zoneVersion = 0;
+    unsigned layout = 0, clusterLayout = ~0u;// ġ ٲ  layout ø
+
+    void refreshZones() const;
+    void rescanZone(int z) const;
+    void setScore(int i, Score s);
+};
+
+VideoTable buildTable(const vector<Video>& videos);
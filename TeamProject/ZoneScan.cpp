@@ -0,0 +1,48 @@
+#include "Utility.h"
+#include "ZoneScan.h"
+
+Score zoneTopK(const VideoTable& t, int top, vector<int>& rows, ZoneScanInfo* info) {
+    int n = t.size();
+    if (top <= 0 || top > n) throw out_of_range("top out of range");
+    int nz = t.zones();
+    vector<pair<Score, int>> order(nz);
+    for (int z = 0; z < nz; z++) order[z] = make_pair(t.zoneMax(z), z);
+    sort(order.begin(), order.end(), greater<pair<Score, int>>());
+
+    // (, -) ּ : Ⱑ  k°,      з
+    priority_queue<pair<Score, int>, vector<pair<Score, int>>, greater<pair<Score, int>>> heap;
+    int scanned = 0;
+    for (int k = 0; k < nz; k++) {
+        if ((int)heap.size() == top && order[k].first < heap.top().first) break;//  ĭ ִ  Ƿ  ǳʶ
+        int lo = order[k].second * VideoTable::ZONE, hi = min(n, lo + VideoTable::ZONE);
+        const Score* s = t.score.data();
+        scanned++;
+        for (int i = lo; i < hi; i++) {
+            if ((int)heap.size() < top) heap.push(make_pair(s[i], -i));
+            else if (make_pair(s[i], -i) > heap.top()) { heap.pop(); heap.push(make_pair(s[i], -i)); }
+        }
+    }
+    if (info) { info->zones = nz; info->scanned = scanned; }
+
+    Score kth = heap.top().first;
+    rows.clear();
+    while (!heap.empty()) { rows.push_back(-heap.top().second); heap.pop(); }
+    reverse(rows.begin(), rows.end());
+    return kth;
+}
+
+void zoneRange(const VideoTable& t, Score lo, Score hi, vector<int>& rows, ZoneScanInfo* info) {
+    int n = t.size(), nz = t.zones(), scanned = 0;
+    rows.clear();
+    for (int z = 0; z < nz; z++) {
+        if (t.zoneMax(z) < lo || t.zoneMin(z) > hi) continue;
+        scanned++;
+        int a = z * VideoTable::ZONE, b = min(n, a + VideoTable::ZONE);
+        if (t.zoneMin(z) >= lo && t.zoneMax(z) <= hi) {//ĭ ü  ̸    
+            for (int i = a; i < b; i++) rows.push_back(i);
+            continue;
+        }
+        for (int i = a; i < b; i++) if (t.score[i] >= lo && t.score[i] <= hi) rows.push_back(i);
+    }
+    if (info) { info->zones = nz; info->scanned = scanned; }
+}
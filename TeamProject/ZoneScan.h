@@ -0,0 +1,15 @@
+#pragma once
+#include "Utility.h"
+#include "VideoTable.h"
+
+// VideoTable score zone map ̿ ȱ. ִ ū ĭ ,      ĭ ° ǳʶ
+//      κ ĭ top-k  Ʒ  д  ũ پ
+struct ZoneScanInfo {
+    int zones = 0;//ü ĭ 
+    int scanned = 0;//   ĭ 
+};
+
+// sequentialSelectó top°(1) ū  ȯϰ, rows  top ( ,   )
+Score zoneTopK(const VideoTable& t, int top, vector<int>& rows, ZoneScanInfo* info = nullptr);
+// lo <= score <= hi   ( )
+void zoneRange(const VideoTable& t, Score lo, Score hi, vector<int>& rows, ZoneScanInfo* info = nullptr);